@@ -0,0 +1,95 @@
+/***********************************************************************[pfheapbench.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+// Standalone benchmark of the VSIDS heaps. Every round pops 8 variables
+// as decisions, bumps 16 random variables as conflict analysis does and
+// re-inserts the popped ones as backtracking does. All heaps replay the
+// same sequence, so the pops must agree.
+// Usage: pfheapbench [<rounds> [<vars> ...]]
+
+#include "../pfheap.h"
+#include "../pfkey.h"
+#include <chrono>
+#include <random>
+
+using namespace pFROST;
+
+static const uint32 POPS = 8, BUMPS = 16;
+
+struct VSIDS {
+	Vec<double> act;
+	double inc;
+	VSIDS(const uint32& vars) : act(vars + 1, 0.0), inc(1.0) {}
+	// returns true if all activities were rescaled
+	inline bool bump(const uint32& v) {
+		act[v] += inc;
+		if (act[v] <= 1e150) return false;
+		for (uint32 x = 1; x < act.size(); x++) act[x] *= 1e-150;
+		inc *= 1e-150;
+		return true;
+	}
+};
+
+template <class H> inline void refresh(H&) {}
+template <int ARITY> inline void refresh(DHEAP<ARITY>& heap) { heap.refresh(); }
+
+template <class H>
+double run(const char* name, const uint32& vars, const uint32& rounds, uint64& checksum) {
+	VSIDS vsids(vars);
+	H heap = H(vsids.act);
+	for (uint32 v = 1; v <= vars; v++) heap.insert(v);
+	std::mt19937 rng(vars);
+	std::uniform_int_distribution<uint32> pick(1, vars);
+	uint32 popped[POPS];
+	checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32 r = 0; r < rounds; r++) {
+		for (uint32 k = 0; k < POPS; k++) checksum = checksum * 31 + (popped[k] = heap.pop());
+		for (uint32 k = 0; k < BUMPS; k++) {
+			const uint32 v = pick(rng);
+			if (vsids.bump(v)) refresh(heap);
+			heap.bump(v);
+		}
+		vsids.inc *= 1 / 0.95;
+		for (uint32 k = 0; k < POPS; k++) heap.insert(popped[k]);
+	}
+	const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	fprintf(stdout, "  %-10s %10u vars %8u rounds %8.3f s\n", name, vars, rounds, secs);
+	return secs;
+}
+
+int main(int argc, char** argv) {
+	const uint32 rounds = argc > 1 ? uint32(atol(argv[1])) : 300000;
+	std::vector<uint32> sizes;
+	for (int i = 2; i < argc; i++) sizes.push_back(uint32(atol(argv[i])));
+	if (sizes.empty()) sizes = { 30000, 1000000, 8000000 };
+	for (const uint32& vars : sizes) {
+		uint64 binary = 0, dary[3] = { 0, 0, 0 };
+		run<HEAP<HEAP_CMP>>("binary", vars, rounds, binary);
+		run<DHEAP<2>>("dheap<2>", vars, rounds, dary[0]);
+		run<DHEAP<4>>("dheap<4>", vars, rounds, dary[1]);
+		run<DHEAP<8>>("dheap<8>", vars, rounds, dary[2]);
+		for (const uint64& sum : dary) {
+			if (sum != binary) {
+				fprintf(stderr, "error: heaps popped different variables\n");
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
@@ -38,9 +38,14 @@ namespace pFROST {
         S sz, cap, maxCap;
         S _junk;
         size_t _bucket;
+        Byte _cat;
+        bool _paged;
+        inline void account(const S& oldCap) const {
+            if (cap != oldCap) memAccount.account(_cat, (int64(cap) - int64(oldCap)) * int64(_bucket));
+        }
         bool check(const S& d) const {
             if (d >= sz) {
-                PFLOGEN("memory index (%zd) violates memory boundary (%zd)", d, sz);
+                PFLOGEN("memory index (%zd) violates memory boundary (%zd)", (size_t)d, (size_t)sz);
                 return false;
             }
             return true;
@@ -58,7 +63,7 @@ namespace pFROST {
         }
         bool checkSize(const S& newSz) const {
             if (sz != 0 && newSz <= sz) {
-                PFLOGEN("size overflow during memory allocation: (new = %zd, old = %zd)", newSz, sz);
+                PFLOGEN("size overflow during memory allocation: (new = %zd, old = %zd)", (size_t)newSz, (size_t)sz);
                 return false;
             }
             return true;
@@ -68,41 +73,57 @@ namespace pFROST {
                         SMM         () {
             maxCap = std::numeric_limits<S>::max();
             assert(maxCap > INT8_MAX);
-            _mem = NULL, _bucket = sizeof(T), sz = 0LL, cap = 0LL, _junk = 0LL;
+            _mem = NULL, _bucket = sizeof(T), sz = 0LL, cap = 0LL, _junk = 0LL, _cat = MEM_OTHER, _paged = false;
         }
         explicit        SMM         (const S& _cap) {
             maxCap = std::numeric_limits<S>::max();
             assert(maxCap > INT8_MAX);
-            _mem = NULL, _bucket = sizeof(T), sz = 0LL, cap = 0LL, _junk = 0LL, init(_cap);
+            _mem = NULL, _bucket = sizeof(T), sz = 0LL, cap = 0LL, _junk = 0LL, _cat = MEM_OTHER, _paged = false, init(_cap);
+        }
+        inline void     dealloc     () {
+            const S oldCap = cap;
+            pffree(_mem, _paged, _bucket * oldCap);
+            sz = cap = 0, _junk = 0;
+            account(oldCap);
         }
-        inline void     dealloc     () { if (_mem != NULL) std::free(_mem), _mem = NULL; sz = cap = 0, _junk = 0; }
         inline size_t   bucket      () const { assert(_bucket); return _bucket; }
         inline S        size        () const { return sz; }
+        inline S        capacity    () const { return cap; }
         inline S        garbage     () const { return _junk; }
         inline T&       operator[]  (const S& idx) { assert(check(idx)); return _mem[idx]; }
         inline const T& operator[]  (const S& idx) const { assert(check(idx)); return _mem[idx]; }
         inline T*       address     (const S& idx) { assert(check(idx)); return _mem + idx; }
         inline const T* address     (const S& idx) const { assert(check(idx)); return _mem + idx; }
+        inline bool     owns        (const T* p) const { return p >= _mem && p < _mem + sz; }
         inline void     collect     (const S& size) { _junk += size; }
+        inline void     limit       (const S& max_cap) { assert(max_cap > INT8_MAX); maxCap = max_cap; }
         inline void     init        (const S& init_cap) {
             if (!init_cap) return;
             assert(_bucket);
             if (init_cap > maxCap) {
-                PFLOG1("Error - initial size exceeds maximum memory size: (max = %zd, size = %zd)\n", maxCap, init_cap);
+                PFLOG1("Error - initial size exceeds maximum memory size: (max = %zd, size = %zd)\n", (size_t)maxCap, (size_t)init_cap);
                 throw MEMOUTEXCEPTION();
             }
+            const S oldCap = cap;
             cap = init_cap;
-            pfalloc(_mem, _bucket * cap);
+            pfrealloc(_mem, _paged, _bucket * oldCap, _bucket * cap, _cat);
+            account(oldCap);
         }
         inline void     reserve     (const S& min_cap) {
             if (cap >= min_cap) return;
+            const S oldCap = cap;
             if (cap > (maxCap - cap)) cap = min_cap;
             else { cap <<= 1; if (cap < min_cap) cap = min_cap; }
             assert(_bucket);
-            pfalloc(_mem, _bucket * cap);
+            pfrealloc(_mem, _paged, _bucket * oldCap, _bucket * cap, _cat);
+            account(oldCap);
         }
         inline S        alloc       (const S& size) {
             assert(size > 0);
+            if (size >= maxCap - sz) {
+                PFLOG1("Error - memory pool of %zd buckets is exhausted", (size_t)maxCap);
+                throw MEMOUTEXCEPTION();
+            }
             assert(checkSize(sz + size));
             reserve(sz + size);
             S oldSz = sz;
@@ -111,9 +132,19 @@ namespace pFROST {
             return oldSz;
         }
         inline void     migrate     (SMM& newBlock) {
-            if (newBlock._mem != NULL) std::free(newBlock._mem);
-            newBlock._mem = _mem, newBlock.sz = sz, newBlock.cap = cap, newBlock._junk = _junk;
-            _mem = NULL, sz = 0, cap = 0, _junk = 0;
+            newBlock.dealloc();
+            newBlock._mem = _mem, newBlock.sz = sz, newBlock.cap = cap, newBlock._junk = _junk, newBlock._paged = _paged;
+            newBlock.account(0);
+            const S oldCap = cap;
+            _mem = NULL, sz = 0, cap = 0, _junk = 0, _paged = false;
+            account(oldCap);
+        }
+        // account the pool to 'cat'
+        inline void     tag         (const Byte& cat) {
+            assert(cat < MEM_CATS);
+            const int64 bytes = int64(cap) * int64(_bucket);
+            if (bytes) memAccount.account(_cat, -bytes), memAccount.account(cat, bytes);
+            _cat = cat;
         }
     };
 
@@ -31,6 +31,7 @@ inline void	ParaFROST::bumpClause(CLAUSE& c) {
 		if (new_lbd <= opts.lbd_tier1) c.set_keep(1);
 		else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) c.initTier2();
 		c.set_lbd(new_lbd);
+		if (old_lbd > opts.lbd_tier2 && tierOf(c) == CM_HOT) cm.promote(c, CM_COLD, CM_HOT);
 		PFLCLAUSE(4, c, " Bumping clause with lbd %d ", new_lbd);
 	}
 	else if (used && old_lbd <= opts.lbd_tier2) c.initTier2();
@@ -358,6 +359,7 @@ void ParaFROST::analyze()
 	clearAnalyzed(), clearMinimized();
 	// subsume recent learnts 
 	if (opts.learntsub_max && REASON(added)) subsumeLearnt(added);
+	if (opts.telemetry_path) publish();
 	printStats(vsidsOnly() && nConflicts % opts.prograte == 0);
 }
 
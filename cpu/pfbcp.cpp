@@ -19,103 +19,133 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "pfsolve.h"
 using namespace pFROST;
 
+// attaching to another list may move the watch slab, so the
+// walkers of the current list are re-pointed afterwards
+#define ATTACH_REBASED(LIT, IMP, REF, SIZE) \
+	do { \
+		const size_t io = i - base, jo = j - base, eo = wend - base; \
+		attachWatch(LIT, IMP, REF, SIZE); \
+		if (wt.base() != base) base = wt.base(), i = base + io, j = base + jo, wend = base + eo; \
+	} while (0)
+
 bool ParaFROST::BCP()
 {
 	conflict = NOREF;
-	uint32 propsBefore = sp->propagated;
+	uint32 propsBefore = sp->propagated, binPropagated = sp->propagated;
+	int64 ticks = 0;
 	bool noConflict = true;
-	while (noConflict && sp->propagated < trail.size()) {
+	while (noConflict) {
+		// binary implications of the whole pending trail come first
+		while (noConflict && binPropagated < trail.size()) {
+			uint32 assign = trail[binPropagated++];
+			int assign_dl = l2dl(assign);
+			assert(assign > 1);
+			WL bs = wtBin[assign];
+			ticks += 1 + cacheLines(bs.size() * sizeof(WATCH));
+			WATCH* i = bs, * j = i, * wend = bs.end();
+			while (i != wend) {
+				const WATCH& w = *j++ = *i++;
+				assert(w.binary());
+				uint32 imp = w.imp;
+				assert(imp > 1 && imp < NOVAR);
+				LIT_ST impVal = value(imp);
+				if (impVal > 0) continue;
+				C_REF r = w.ref;
+				ticks++;
+				if (cm[r].deleted()) { j--; continue; }
+				if (!impVal) { conflict = r, noConflict = false; break; }
+				enqueue(imp, assign_dl, r);
+			}
+			if (j != i) {
+				while (i != wend) *j++ = *i++;
+				bs.resize(int(j - bs));
+			}
+		}
+		if (!noConflict || sp->propagated == trail.size()) break;
+		// then the long clauses of one literal
 		uint32 assign = trail[sp->propagated++], f_assign = FLIP(assign);
 		int assign_dl = l2dl(assign);
 		assert(assign > 1);
 		PFLOG2(3, " Propagating %d@%d", l2i(assign), assign_dl);
 		PFLBCPS(this, 4, assign);
-		WL& ws = wt[assign];
+		WL ws = wt[assign];
+		ticks += 1 + cacheLines(ws.size() * sizeof(WATCH));
 		if (ws.size()) {
-			WATCH* i = ws, * j = i, * wend = ws.end();
+			WATCH* base = wt.base(), * i = ws, * j = i, * wend = ws.end();
 			while (i != wend) {
 				const WATCH& w = *j++ = *i++;
 				uint32 imp = w.imp;
 				assert(imp > 1 && imp < NOVAR);
 				assert(imp != f_assign);
+				assert(!w.binary());
 				LIT_ST impVal = value(imp);
 				if (impVal > 0) continue; // blocking literal
-				//=============== binary ================//
-				if (w.binary()) {
-					C_REF r = w.ref;
-					if (cm[r].deleted()) { j--; continue; }
-					if (!impVal) { conflict = r, noConflict = false; }
-					else enqueue(imp, assign_dl, r);
-				}
-				//================ large =================//
+				C_REF r = w.ref;
+				CLAUSE& c = cm[r];
+				ticks++;
+				if (c.deleted()) { j--; continue; }
+				assert(c.size() > 2);
+				uint32 other = c[0] ^ c[1] ^ f_assign; // Thanks to Cadical solver
+				// check if first literal is true
+				LIT_ST otherVal = value(other);
+				if (otherVal > 0)
+					(j - 1)->imp = other; // satisfied, replace "w.imp" with new blocking "other"
 				else {
-					if (!noConflict) break; // binary conflict found
-					C_REF r = w.ref;
-					CLAUSE& c = cm[r];
-					if (c.deleted()) { j--; continue; }
-					assert(c.size() > 2);
-					uint32 other = c[0] ^ c[1] ^ f_assign; // Thanks to Cadical solver
-					// check if first literal is true
-					LIT_ST otherVal = value(other);
-					if (otherVal > 0)
-						(j - 1)->imp = other; // satisfied, replace "w.imp" with new blocking "other"
-					else {
-						// === search for (un)-assigned-1 literal to watch
-						uint32* cmid = c.mid(), * cend = c.end();
-						uint32* k = cmid, newlit = 0;
-						LIT_ST _false_ = UNDEFINED;
-						while (k != cend && (_false_ = isFalse(newlit = *k))) k++;
-						assert(_false_ != UNDEFINED);
-						if (_false_) {
-							k = c + 2;
-							assert(c.pos() <= c.size());
-							while (k != cmid && (_false_ = isFalse(newlit = *k))) k++;
-						}
-						assert(k >= c + 2 && k <= c.end());
-						c.set_pos(int(k - c)); // set new position
-						// ======== end of search ========
-						LIT_ST val = value(newlit);
-						if (val > 0) {
-							// found satisfied new literal (keep the watch & replace "imp")
-							(j - 1)->imp = newlit;
-						}
-						else if (UNASSIGNED(val)) {
-							// found new unassigned literal to watch
-							c[0] = other;
-							c[1] = newlit;
-							*k = f_assign;
-							attachWatch(newlit, f_assign, r, c.size());
-							j--; // remove j-watch from current assignment
-						}
-						else if (UNASSIGNED(otherVal)) {
-							assert(!val);
-							// clause is unit
-							enqueueImp(other, r);
-							if (opts.chrono_en) {
-								int otherLevel = l2dl(other);
-								if (otherLevel > assign_dl) {
-									uint32* maxPos, * e = c.end(), maxLit = 0;
-									for (maxPos = c + 2; maxPos != e; maxPos++)
-										if (l2dl(maxLit = *maxPos) == otherLevel)
-											break;
-									assert(maxPos < e);
-									assert(maxLit > 1);
-									*maxPos = f_assign;
-									c[0] = other;
-									c[1] = maxLit;
-									attachWatch(maxLit, other, r, c.size());
-									j--; // remove j-watch from current assignment
-								}
+					// === search for (un)-assigned-1 literal to watch
+					uint32* cmid = c.mid(), * cend = c.end();
+					uint32* k = cmid, newlit = 0;
+					LIT_ST _false_ = UNDEFINED;
+					while (k != cend && (_false_ = isFalse(newlit = *k))) k++;
+					assert(_false_ != UNDEFINED);
+					if (_false_) {
+						k = c + 2;
+						assert(c.pos() <= c.size());
+						while (k != cmid && (_false_ = isFalse(newlit = *k))) k++;
+					}
+					assert(k >= c + 2 && k <= c.end());
+					c.set_pos(int(k - c)); // set new position
+					// ======== end of search ========
+					LIT_ST val = value(newlit);
+					if (val > 0) {
+						// found satisfied new literal (keep the watch & replace "imp")
+						(j - 1)->imp = newlit;
+					}
+					else if (UNASSIGNED(val)) {
+						// found new unassigned literal to watch
+						c[0] = other;
+						c[1] = newlit;
+						*k = f_assign;
+						ATTACH_REBASED(newlit, f_assign, r, c.size());
+						j--; // remove j-watch from current assignment
+					}
+					else if (UNASSIGNED(otherVal)) {
+						assert(!val);
+						// clause is unit
+						enqueueImp(other, r);
+						if (opts.chrono_en) {
+							int otherLevel = l2dl(other);
+							if (otherLevel > assign_dl) {
+								uint32* maxPos, * e = c.end(), maxLit = 0;
+								for (maxPos = c + 2; maxPos != e; maxPos++)
+									if (l2dl(maxLit = *maxPos) == otherLevel)
+										break;
+								assert(maxPos < e);
+								assert(maxLit > 1);
+								*maxPos = f_assign;
+								c[0] = other;
+								c[1] = maxLit;
+								ATTACH_REBASED(maxLit, other, r, c.size());
+								j--; // remove j-watch from current assignment
 							}
 						}
-						else {
-							// clause is conflicting
-							assert(!val);
-							assert(!otherVal);
-							PFLCONFLICT(this, 3, other);
-							conflict = r, noConflict = false;
-							break;
-						}
+					}
+					else {
+						// clause is conflicting
+						assert(!val);
+						assert(!otherVal);
+						PFLCONFLICT(this, 3, other);
+						conflict = r, noConflict = false;
+						break;
 					}
 				}
 			} // end of watches loop 
@@ -128,6 +158,7 @@ bool ParaFROST::BCP()
 	} // end of trail loop
 
 	stats.n_props += (sp->propagated - propsBefore);
+	stats.n_ticks += ticks;
 	if (noConflict) sp->trailpivot = sp->propagated;
 	else sp->trailpivot = dlevels.back();
 	return !noConflict;
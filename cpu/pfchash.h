@@ -0,0 +1,114 @@
+/***********************************************************************[pfchash.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfsolvertypes.h"
+#include "pfworker.h"
+#include <vector>
+
+namespace pFROST {
+
+	// Index of clauses keyed by a 64-bit hash of their literal sets. It is
+	// built in parallel once and then only read, so lookups need no locks;
+	// deleted clauses stay in their buckets and are skipped by the caller
+	class CHASH {
+		Vec<size_t, size_t>		_heads;
+		Vec<uint64, size_t>		_keys;
+		Vec<S_REF, size_t>		_refs;
+		size_t					_mask;
+
+		inline static uint64	mix			(uint64 x) {
+			x += 0x9E3779B97F4A7C15ULL;
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+			return x ^ (x >> 31);
+		}
+
+	public:
+		inline					CHASH		() : _mask(0) {}
+		// order-independent hash of a literal set
+		inline static uint64	hash		(const uint32* lits, const int& size) {
+			uint64 h = mix(uint64(size));
+			for (int k = 0; k < size; k++) h += mix(lits[k]);
+			return h ? h : 1;
+		}
+		// index all clauses of 'cnf' with sizes in [2, maxSize]; if 'ordered',
+		// buckets list their clauses by creation order instead of insertion
+		inline void				build		(const SCNF& cnf, WorkerPool& pool, const int& maxSize, const bool& ordered = false) {
+			const size_t n = cnf.size();
+			Vec<uint64, size_t> ckeys(n);
+			size_t buckets = 1;
+			while (buckets < n) buckets <<= 1;
+			_mask = buckets - 1;
+			std::vector<std::atomic<size_t>> count(buckets);
+			pool.doWorkForEach((size_t)0, n, [&](size_t i) {
+				const S_REF c = cnf[i];
+				ckeys[i] = 0;
+				if (c->deleted() || c->size() < 2 || c->size() > maxSize) return;
+				ckeys[i] = hash(c->data(), c->size());
+				count[ckeys[i] & _mask]++;
+			});
+			pool.join();
+			_heads.resize(buckets + 1);
+			_heads[0] = 0;
+			for (size_t b = 0; b < buckets; b++) _heads[b + 1] = _heads[b] + count[b], count[b] = _heads[b];
+			_keys.resize(_heads[buckets]), _refs.resize(_heads[buckets]);
+			pool.doWorkForEach((size_t)0, n, [&](size_t i) {
+				if (!ckeys[i]) return;
+				const size_t pos = count[ckeys[i] & _mask]++;
+				_keys[pos] = ckeys[i], _refs[pos] = cnf[i];
+			});
+			pool.join();
+			if (ordered) {
+				pool.doWorkForEach((size_t)0, buckets, [&](size_t b) {
+					for (size_t i = _heads[b] + 1; i < _heads[b + 1]; i++) {
+						const uint64 key = _keys[i];
+						const S_REF ref = _refs[i];
+						size_t j = i;
+						for (; j > _heads[b] && _refs[j - 1]->id() > ref->id(); j--)
+							_keys[j] = _keys[j - 1], _refs[j] = _refs[j - 1];
+						_keys[j] = key, _refs[j] = ref;
+					}
+				});
+				pool.join();
+			}
+		}
+		// first indexed clause with key 'h' accepted by 'pred', or NULL
+		template<class Predicate>
+		inline S_REF			find		(const uint64& h, const Predicate& pred) {
+			assert(_heads.size());
+			const size_t b = h & _mask;
+			for (size_t i = _heads[b]; i < _heads[b + 1]; i++) {
+				if (_keys[i] == h && pred(_refs[i])) return _refs[i];
+			}
+			return NULL;
+		}
+		inline size_t			buckets		() const { return _heads.size() ? _heads.size() - 1 : 0; }
+		// visit every pair of indexed clauses with equal keys in bucket 'b'
+		template<class Function>
+		inline void				forEachPair	(const size_t& b, const Function& fn) const {
+			for (size_t i = _heads[b]; i < _heads[b + 1]; i++)
+				for (size_t j = i + 1; j < _heads[b + 1]; j++)
+					if (_keys[i] == _keys[j]) fn(_refs[i], _refs[j]);
+		}
+		inline void				clear		() { _heads.clear(true), _keys.clear(true), _refs.clear(true), _mask = 0; }
+		inline static size_t	bytes		(const size_t& n) { return n * (2 * sizeof(size_t) + sizeof(uint64) + sizeof(S_REF)); }
+	};
+
+}
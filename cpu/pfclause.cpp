@@ -55,6 +55,7 @@ void ParaFROST::bumpShrunken(CLAUSE& c) {
 	if (new_lbd <= opts.lbd_tier1) c.set_keep(1);
 	else if (old_lbd > opts.lbd_tier2 && new_lbd <= opts.lbd_tier2) c.initTier2();
 	c.set_lbd(new_lbd);
+	if (old_lbd > opts.lbd_tier2 && tierOf(c) == CM_HOT) cm.promote(c, CM_COLD, CM_HOT);
 	PFLCLAUSE(4, c, " Bumping shrunken clause with LBD %d ", new_lbd);
 }
 
@@ -88,7 +89,7 @@ void ParaFROST::shrinkClause(CLAUSE& c, const int& remLits)
 {
 	if (!remLits) return;
 	c.shrink(remLits); // adjusts "pos" also
-	cm.collect(remLits);
+	cm.collect(c, int(cm.calcSize(c.size() + remLits) - cm.calcSize(c.size())), tierOf(c));
 	assert(c.size() > 1);
 	if (c.original()) { assert(inf.nLiterals), inf.nLiterals -= remLits; }
 	else {
@@ -131,13 +132,14 @@ void ParaFROST::removeClause(const C_REF& r) {
 		wrProof(c, sz);
 		wrProof(0);
 	}
-	c.markDeleted(), cm.collect(r);
+	cm.collect(r, tierOf(c)), c.markDeleted();
 }
 
 C_REF ParaFROST::newClause(const Lits_t& in_c, const CL_ST& type)
 {
-	C_REF r = cm.alloc(in_c);
 	int sz = in_c.size();
+	int trim_lbd = ISORG(type) ? 0 : (sp->learnt_lbd > sz ? sz : sp->learnt_lbd);
+	C_REF r = cm.alloc(in_c, tierOf(type, trim_lbd, trim_lbd <= opts.lbd_tier1));
 	CLAUSE& c = cm[r];
 	assert(sz > 1);
 	assert(sz == c.size());
@@ -154,7 +156,6 @@ C_REF ParaFROST::newClause(const Lits_t& in_c, const CL_ST& type)
 	}
 	else {
 		assert(sp->learnt_lbd > 0);
-		int trim_lbd = sp->learnt_lbd > sz ? sz : sp->learnt_lbd;
 		c.set_lbd(trim_lbd);
 		c.set_keep(trim_lbd <= opts.lbd_tier1);
 		if (sp->learnt_lbd <= opts.lbd_tier1) c.initTier1(), stats.n_glues++;			// Tier1
@@ -23,6 +23,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "pfalloc.h"
 #include "pfvec.h"
 #include <cassert>
+#include <cstring>
 #include <string>
 
 namespace pFROST {
@@ -31,10 +32,14 @@ namespace pFROST {
 	/*  Usage:   simple structure for CNF clause storage */
 	/*  Dependency:  none                                */
 	/*****************************************************/
+	// status, flags, usage and LBD share one 32-bit word, so the
+	// header is 12 bytes and 'c[0]'/'c[1]' sit right behind it.
+	// The forwarding reference of a moved clause overlays the first
+	// literals and is copied bytewise as clauses are only 4-byte aligned
 	class CLAUSE {
-		CL_ST	_st, _k, _b, _r, _u, _m, _s;
-		int		_sz, _pos, _lbd;
-		union { uint32 _lits[2]; C_REF _ref; };
+		uint32	_st : 3, _k : 1, _b : 1, _r : 1, _u : 2, _m : 1, _s : 1, _lbd : LBD_BITS;
+		int		_sz, _pos;
+		uint32	_lits[2];
 	public:
 		size_t				capacity	() const { return (size_t(_sz) - 2) * sizeof(uint32) + sizeof(*this); }
 		inline				CLAUSE		() {
@@ -75,9 +80,9 @@ namespace pFROST {
 		inline	void		pop			() { _sz--, _b = _sz == 2; }
 		inline	int			size		() const { return _sz; }
 		inline	int			pos			() const { return _pos; }
-		inline	C_REF		ref			() const { return _ref; }
+		inline	C_REF		ref			() const { C_REF r; std::memcpy(&r, _lits, sizeof(C_REF)); return r; }
 		inline	int			lbd			() const { return _lbd; }
-		inline	CL_ST		status		() const { return _st; }
+		inline	CL_ST		status		() const { return CL_ST(_st); }
 		inline	bool		deleted		() const { return _st & DELETED; }
 		inline	bool		original	() const { return _st & ORIGINAL; }
 		inline	bool		learnt		() const { return _st & LEARNT; }
@@ -86,11 +91,11 @@ namespace pFROST {
 		inline	bool		moved		() const { return _m; }
 		inline	bool		subsume		() const { return _s; }
 		inline	bool		keep		() const { return _k; }
-		inline	CL_ST		usage		() const { return _u; }
+		inline	CL_ST		usage		() const { return CL_ST(_u); }
 		inline	void		initTier1	() { _u = USAGET2; }
 		inline	void		initTier2	() { _u = USAGET2; }
 		inline	void		initTier3	() { _u = USAGET3; }
-		inline	void		warm		() { _u--; }
+		inline	void		warm		() { assert(_u); _u--; }
 		inline  void		initMoved	() { _m = 0; }
 		inline	void		initReason	() { _r = 0; }
 		inline	void		initSubsume	() { _s = 0; }
@@ -108,9 +113,9 @@ namespace pFROST {
 			if (_pos >= _sz) _pos = 2;
 			_b = _sz == 2;
 		}
-		inline	void		set_ref		(const C_REF& r) { _m = 1, _ref = r; }
+		inline	void		set_ref		(const C_REF& r) { _m = 1, std::memcpy(_lits, &r, sizeof(C_REF)); }
 		inline	void		set_pos		(const int& newPos) { assert(newPos >= 2); _pos = newPos; }
-		inline	void		set_lbd		(const int& lbd) { _lbd = lbd; }
+		inline	void		set_lbd		(const int& lbd) { assert(lbd >= 0); _lbd = lbd > LBD_MAX ? LBD_MAX : lbd; }
 		inline	void		set_status	(const CL_ST& status) { _st = status; }
 		inline	void		set_usage	(const CL_ST& usage) { _u = usage; }
 		inline	void		set_keep	(const bool& keep) { _k = keep; }
@@ -128,45 +133,128 @@ namespace pFROST {
 			fprintf(stdout, ") %c:%d, used=%d, lbd=%d\n", st, reason(), usage(), lbd());
 		}
 	};
+	static_assert(LBD_BITS > 0 && LBD_BITS <= 22, "LBD_BITS must leave the clause header in one word");
 	/*****************************************************/
 	/*  Usage: memory manager for CNF clauses            */
 	/*  Dependency:  CLAUSE                              */
 	/*****************************************************/
-	typedef SMM<Byte, C_REF> CTYPE;
-	class CMM : public CTYPE
+	// Clauses live in separate regions for originals, tier1/2 and
+	// tier3 learnts, each collected on its own. The region is kept
+	// in the two top bits of a reference (NOREF is never valid), so
+	// a region spans 2^30 words (8 GB) with COMPACT_REFS
+	enum CM_REGION : Byte { CM_ORG, CM_HOT, CM_COLD, CM_REGIONS };
+#define CM_SHIFT (sizeof(C_REF) * 8 - 2)
+#define CM_MASK ((C_REF(1) << CM_SHIFT) - 1)
+	typedef SMM<C_WORD, C_REF> CTYPE;
+	class CMM
 	{
+		CTYPE					_regions[CM_REGIONS];
+		C_REF					_promoted[CM_REGIONS][CM_REGIONS]; // words waiting to move [from][to]
+		Byte					_open;
+
+		inline C_REF			allocIn		(const Byte& g, const size_t& cWords) {
+			assert(g < CM_REGIONS);
+			return (C_REF(g) << CM_SHIFT) | _regions[g].alloc(C_REF(cWords));
+		}
 	public:
-								CMM			() {}
-		explicit				CMM			(const C_REF& init_cap) : CTYPE(init_cap) {}
-		inline void				init		(const C_REF& init_cap) { CTYPE::init(init_cap * sizeof(CLAUSE)); }
-		inline		 CLAUSE&	operator[]	(const C_REF& r) { return (CLAUSE&)CTYPE::operator[](r); }
-		inline const CLAUSE&	operator[]	(const C_REF& r) const { return (CLAUSE&)CTYPE::operator[](r); }
-		inline		 CLAUSE*	clause		(const C_REF& r) { return (CLAUSE*)address(r); }
-		inline const CLAUSE*	clause		(const C_REF& r) const { return (CLAUSE*)address(r); }
-		inline void				collect		(const C_REF& r) { CTYPE::collect(calcSize(clause(r)->size())); }
-		inline void				collect		(const int& size) { CTYPE::collect(size); }
-		inline size_t			calcSize	(const int& size) { return (sizeof(CLAUSE) + (size_t(size) - 2) * sizeof(uint32)); }
-		inline void				migrate		(CMM& newblock) { CTYPE::migrate(newblock); }
+								CMM			() : _open(0) {
+			for (Byte g = 0; g < CM_REGIONS; g++)
+				_regions[g].tag(MEM_CMM), _regions[g].limit(CM_MASK), clearPromoted(g);
+		}
+		inline static Byte		region		(const C_REF& r) { return Byte(r >> CM_SHIFT); }
+		// region holding 'c'
+		inline Byte				region		(const CLAUSE& c) const {
+			for (Byte g = 0; g < CM_REGIONS; g++)
+				if (_regions[g].owns((const C_WORD*)&c)) return g;
+			assert(0);
+			return CM_ORG;
+		}
+		inline bool				check		(const C_REF& r) const { return region(r) < CM_REGIONS && (r & CM_MASK) < _regions[region(r)].size(); }
+		inline void				init		(const C_REF& init_cap) { open(CM_ORG, C_REF(init_cap * sizeof(CLAUSE) / sizeof(C_WORD))); }
+		// reserve 'cWords' in region 'g' and make it a destination of 'migrate'
+		inline void				open		(const Byte& g, const C_REF& cWords) { _regions[g].init(cWords), _open |= Byte(1 << g); }
+		inline bool				opened		(const Byte& g) const { return _open & (1 << g); }
+		inline		 CLAUSE&	operator[]	(const C_REF& r) { return *(CLAUSE*)_regions[region(r)].address(r & CM_MASK); }
+		inline const CLAUSE&	operator[]	(const C_REF& r) const { return *(const CLAUSE*)_regions[region(r)].address(r & CM_MASK); }
+		inline		 CLAUSE*	clause		(const C_REF& r) { return (CLAUSE*)_regions[region(r)].address(r & CM_MASK); }
+		inline const CLAUSE*	clause		(const C_REF& r) const { return (const CLAUSE*)_regions[region(r)].address(r & CM_MASK); }
+		inline size_t			bucket		() const { return sizeof(C_WORD); }
+		inline C_REF			size		(const Byte& g) const { return _regions[g].size(); }
+		inline C_REF			garbage		(const Byte& g) const { return _regions[g].garbage(); }
+		inline C_REF			capacity	(const Byte& g) const { return _regions[g].capacity(); }
+		inline C_REF			size		() const { C_REF n = 0; for (const CTYPE& m : _regions) n += m.size(); return n; }
+		inline C_REF			garbage		() const { C_REF n = 0; for (const CTYPE& m : _regions) n += m.garbage(); return n; }
+		inline C_REF			capacity	() const { C_REF n = 0; for (const CTYPE& m : _regions) n += m.capacity(); return n; }
+		inline C_REF			promoted	(const Byte& g) const { C_REF n = 0; for (const C_REF& w : _promoted[g]) n += w; return n; }
+		// garbage plus clauses waiting to move to another region exceed 'perc'
+		inline bool				wasteful	(const Byte& g, const double& perc) const {
+			return _regions[g].garbage() + promoted(g) > _regions[g].size() * perc;
+		}
+		// words region 'g' holds after collecting the regions in mask 'collected'
+		inline C_REF			live		(const Byte& g, const Byte& collected) const {
+			C_REF n = _regions[g].size() - _regions[g].garbage() - promoted(g);
+			for (Byte h = 0; h < CM_REGIONS; h++)
+				if (collected & (1 << h)) n += _promoted[h][g];
+			return n;
+		}
+		// 'to' is the region 'r' belongs to by its tier; a clause still
+		// waiting there is no longer moved
+		inline void				collect		(const C_REF& r, const Byte& to) {
+			const Byte g = region(r);
+			const C_REF cWords = C_REF(calcSize(clause(r)->size()));
+			_regions[g].collect(cWords);
+			if (g != to) assert(_promoted[g][to] >= cWords), _promoted[g][to] -= cWords;
+		}
+		inline void				collect		(const CLAUSE& c, const int& cWords, const Byte& to) {
+			const Byte g = region(c);
+			_regions[g].collect(C_REF(cWords));
+			if (g != to) assert(_promoted[g][to] >= C_REF(cWords)), _promoted[g][to] -= C_REF(cWords);
+		}
+		// 'c' changed its tier 'from' to 'to' and leaves its region on the next collection
+		inline void				promote		(const CLAUSE& c, const Byte& from, const Byte& to) {
+			const Byte g = region(c);
+			const C_REF cWords = C_REF(calcSize(c.size()));
+			if (g != from) assert(_promoted[g][from] >= cWords), _promoted[g][from] -= cWords;
+			if (g != to) _promoted[g][to] += cWords;
+		}
+		inline void				clearPromoted(const Byte& g) { for (C_REF& w : _promoted[g]) w = 0; }
+		// clause size in arena words
+		inline size_t			calcSize	(const int& size) const {
+			return (sizeof(CLAUSE) + (size_t(size) - 2) * sizeof(uint32) + sizeof(C_WORD) - 1) / sizeof(C_WORD);
+		}
+		// hand the opened regions over to 'dest', the others are left as they are
+		inline void				migrate		(CMM& dest) {
+			for (Byte g = 0; g < CM_REGIONS; g++) {
+				if (!opened(g)) continue;
+				_regions[g].migrate(dest._regions[g]);
+				dest.clearPromoted(g);
+			}
+			_open = 0;
+		}
 		template <class SRC>
-		inline C_REF			alloc		(const SRC& src) {
+		inline C_REF			alloc		(const SRC& src, const Byte& g = CM_ORG) {
 			assert(src.size() > 1);
-			size_t cBytes = calcSize(src.size());
-			C_REF r = CTYPE::alloc(cBytes);
+			size_t cWords = calcSize(src.size());
+			C_REF r = allocIn(g, cWords);
 			new (clause(r)) CLAUSE(src);
-			assert(clause(r)->capacity() == cBytes);
+			assert(clause(r)->capacity() <= cWords * sizeof(C_WORD));
 			assert(src.size() == clause(r)->size());
 			return r;
 		}
-		inline C_REF			alloc		(const int& size) {
+		inline C_REF			alloc		(const int& size, const Byte& g = CM_ORG) {
 			assert(size > 1);
-			size_t cBytes = calcSize(size);
-			C_REF r = CTYPE::alloc(cBytes);
+			size_t cWords = calcSize(size);
+			C_REF r = allocIn(g, cWords);
 			new (clause(r)) CLAUSE(size);
-			assert(clause(r)->capacity() == cBytes);
+			assert(clause(r)->capacity() <= cWords * sizeof(C_WORD));
 			assert(size == clause(r)->size());
 			return r;
 		}
-		inline void				destroy		() { dealloc(); }
+		inline void				destroy		() {
+			for (Byte g = 0; g < CM_REGIONS; g++)
+				_regions[g].dealloc(), clearPromoted(g);
+			_open = 0;
+		}
 	};
 
 }
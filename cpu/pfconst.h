@@ -32,9 +32,20 @@ namespace pFROST {
 #define MBYTE 0x00100000UL
 #define KBYTE 0x00000400UL
 #define GBYTE 0x40000000UL
+#ifdef COMPACT_REFS
+#define NOREF UINT32_MAX
+#else
 #define NOREF UINT64_MAX
+#endif
 #define NOVAR UINT32_MAX
+// bits of the packed clause header given to the LBD; larger
+// LBDs are saturated at LBD_MAX
+#ifndef LBD_BITS
+#define LBD_BITS 22
+#endif
+#define LBD_MAX ((1 << LBD_BITS) - 1)
 #define INIT_CAP 32
+#define CACHELINE 64
 #define UNSOLVED -1
 #define UNSAT 0
 #define SAT 1
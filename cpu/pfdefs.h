@@ -83,12 +83,13 @@ namespace pFROST {
 		std::chrono::high_resolution_clock::time_point _timeout;
 	public:
 		float parse, solve, simp;
-		float vo, ve, hse, bce, ere, cot, rot, sot, gc, io, ce, igr;
+		float vo, ve, hse, bce, ere, dce, cot, rot, sot, gc, io, ce, igr;
 		float igr_part[IGR_COUNT];
 		TIMER				() { memset(this, 0, sizeof(*this)); }
 		void start			() { _start = std::chrono::high_resolution_clock::now(); }
 		void stop			() { _stop = std::chrono::high_resolution_clock::now(); }
 		float cpuTime		() { return ((float)std::chrono::duration_cast<std::chrono::milliseconds>(_stop - _start).count()) / 1000; }
+		float elapsed		() { return ((float)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - _start).count()) / 1000; }
 		void pstart			() { _start_p = std::chrono::high_resolution_clock::now(); }
 		void pstop			() { _stop_p = std::chrono::high_resolution_clock::now(); }
 		float pcpuTime		() { return ((float)std::chrono::duration_cast<std::chrono::microseconds>(_stop_p - _start_p).count()) / 1000; }
@@ -147,6 +148,9 @@ namespace pFROST {
 		return true;
 	}
 	inline double	ratio			(const double& x, const double& y) { return y ? x / y : 0; }
+	inline int64	cacheLines		(const size_t& bytes) { return int64((bytes + CACHELINE - 1) / CACHELINE); }
+	// simplifier ticks charged by the calling thread, collected per job in 'forEachPV'
+	inline thread_local int64 simpTicks = 0;
 	inline int		l2i				(const uint32& lit) { assert(lit > 1); return SIGN(lit) ? -int(ABS(lit)) : int(ABS(lit)); }
 	inline uint32	maxInactive		() { return inf.maxMelted + inf.maxFrozen; }
 	inline uint32	maxActive		() { assert(inf.maxVar >= maxInactive()); return inf.maxVar - maxInactive(); }
@@ -30,10 +30,21 @@ namespace pFROST {
 	typedef signed char CL_ST;
 	typedef signed char CNF_ST;
 	typedef signed char LIT_ST;
+	typedef unsigned short uint16;
 	typedef unsigned int uint32;
 	typedef signed long long int int64;
 	typedef unsigned long long int uint64;
+	// with COMPACT_REFS, clause references are 32-bit offsets
+	// counted in 8-byte words instead of byte offsets, which halves
+	// watches and reason sources; two bits select the clause region,
+	// so every region is limited to 8 GB
+#ifdef COMPACT_REFS
+	typedef uint32 C_REF;
+	typedef uint64 C_WORD;
+#else
 	typedef size_t C_REF;
+	typedef Byte C_WORD;
+#endif
 	typedef void* G_REF;
 
 }
@@ -23,31 +23,30 @@ using namespace SIGmA;
 
 int ParaFROST::prop(SCNF* bin_check)
 {
-	std::mutex m;
-	std::condition_variable cv;
-	int working = workerPool.count();
+	PFTRACE("prop");
+	std::atomic<uint32> head = sp->propagated;
+	std::atomic<int> working = workerPool.count();
+	std::atomic<bool> conflict = (cnfstate == UNSAT);
+	std::vector<SCNF> bins(bin_check != nullptr ? workerPool.count() : 0);
 	nForced = sp->propagated;
+	openTrail();
 
 	workerPool.doWork([&] {
-		uint32 assign = 0;
-		while (cnfstate == UNSOLVED) {
-			{
-				std::unique_lock<std::mutex> lock(m);
+		while (!conflict.load(std::memory_order_relaxed)) {
+			uint32 idx = head.load();
+			if (idx == tail_s.load()) {
+				// idle until new units arrive or all workers are idle
 				working--;
-
-				while (sp->propagated == trail.size()) {
-					if (working == 0 || cnfstate == UNSAT) {
-						cv.notify_all();
-						return;
-					}
-					else cv.wait(lock);
+				while (true) {
+					if (conflict.load(std::memory_order_relaxed)) return;
+					if (head.load() < tail_s.load()) { working++; break; }
+					if (!working.load() && head.load() == tail_s.load()) return;
+					std::this_thread::yield();
 				}
-
-				if (cnfstate == UNSAT) break;
-				working++;
-				assign = trail[sp->propagated++];
+				continue;
 			}
-
+			if (!head.compare_exchange_weak(idx, idx + 1)) continue;
+			const uint32 assign = sharedLit(idx);
 			assert(assign > 1);
 			uint32 f_assign = FLIP(assign);
 			// remove satisfied
@@ -55,36 +54,17 @@ int ParaFROST::prop(SCNF* bin_check)
 			// reduce unsatisfied
 			for (int i = 0; i < ot[f_assign].size(); i++) {
 				S_REF c = ot[f_assign][i];
-				//c->print();
 				c->lock();
 				assert(c->size());
 				if (c->deleted() || propClause(c, f_assign)) { c->unlock(); continue; } // clause satisfied
 				// clause is unit or conflict
-				// Note: attach & strengthen don't check for conflict before enqueue
-				if (c->size() == 0) {
+				if (c->size() == 0 || (c->size() == 1 && enqueueShared(**c) < 0)) {
 					c->unlock();
-					std::unique_lock<std::mutex> lock(m);
-					cnfstate = UNSAT;
+					conflict = true;
 					break;
 				}
-				if (c->size() == 1) {
-					assert(**c > 1);
-					std::unique_lock<std::mutex> lock(m);
-					if (unassigned(**c)) {
-						enqueueOrg(**c);
-						cv.notify_one();
-					}
-					else if (isFalse(**c)) {
-						cnfstate = UNSAT;
-						c->unlock();
-						break;
-					}
-				}
-				if (c->size() == 2 && bin_check != nullptr) {
-					bin_check->lock();
-					bin_check->push(c);
-					bin_check->unlock();
-				}
+				if (c->size() == 2 && bin_check != nullptr)
+					bins[workerPool.getID()].push(c);
 				c->unlock();
 			}
 			// delete assign lists
@@ -92,6 +72,13 @@ int ParaFROST::prop(SCNF* bin_check)
 		}
 	});
 	workerPool.join();
+	closeTrail();
+	if (opts.deterministic) std::sort(trail.data() + nForced, trail.end());
+	if (conflict) cnfstate = UNSAT;
+	else sp->propagated = trail.size();
+	for (uint32 i = 0; i < bins.size(); i++)
+		for (uint32 j = 0; j < bins[i].size(); j++)
+			bin_check->push(bins[i][j]);
 
 	if (cnfstate == UNSAT) return -1;
 	nForced = sp->propagated - nForced;
@@ -103,7 +90,8 @@ int ParaFROST::prop(SCNF* bin_check)
 
 void ParaFROST::IGR()
 {
-	if (phase == 0 && opts.igr_en) {
+	PFTRACE("IGR");
+	if (phase == 0 && opts.igr_en && !skipIGR) {
 		if (interrupted()) killSolver();
 		PFLOGN2(2, " Reasoning on the implication graph..");
 		if (opts.profile_simp) timer.pstart();
@@ -111,19 +99,16 @@ void ParaFROST::IGR()
 		// Initialize IG based on original binary clauses.
 		workerPool.doWorkForEach((size_t)0, scnf.size(), [this](size_t i) {
 			S_REF c = scnf[i];
-			if (c->size() == 2 /*&& c->original()*/ && !c->deleted()) append_ig_edge(c, ig);
+			if (c->size() == 2 /*&& c->original()*/ && !c->deleted()) insert_ig_edge(c, ig);
 		});
 		workerPool.join();
 
 		if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[0] += timer.pcpuTime();
 
-		workerPool.doWorkForEach((uint32)0, ig.size(), [this](uint32 i) {
-			ig[i].sortEdges();
-		});
-		workerPool.join();
+		ig.commit(workerPool);
 
 		SCCWrapper sccWrapper;
-		sccWrapper.setNumThreads(opts.worker_count);
+		sccWrapper.setNumThreads(opts.deterministic ? 1 : opts.worker_count);
 		sccWrapper.setMethod(SCC_UFSCC);
 		sccWrapper.setGraph(ig);
 
@@ -151,6 +136,7 @@ void ParaFROST::IGR()
 				if (!c->deleted() && c->size() == 2) insert_ig_edge(c, ig);
 			});
 			workerPool.join();
+			ig.commit(workerPool);
 
 			// SCC equivalence reduction
 			uVec1D resetQueue;
@@ -168,7 +154,7 @@ void ParaFROST::IGR()
 				std::atomic<uint32> sccCount = 0;
 				std::atomic<bool> newEdge = false;
 
-				workerPool.doWorkForEach((uint32)1, inf.maxVar, [&](uint32 v) {
+				workerPool.doWorkForEach((uint32)1, inf.maxVar + 1, [&](uint32 v) {
 					const uint32 lit = V2L(v);
 					scc[FLIP(lit)] = FLIP(scc[lit]);
 				});
@@ -177,7 +163,7 @@ void ParaFROST::IGR()
 				if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[4] += timer.pcpuTime(), timer.pstart();
 
 				// Replace each node with its SCC representative.
-				workerPool.doWorkForEach((uint32)1, inf.maxVar, [&](uint32 v) {
+				auto replace = [&](uint32 v) {
 					const uint32 lit = V2L(v);
 					const uint32 repLit = scc[lit];
 
@@ -210,8 +196,12 @@ void ParaFROST::IGR()
 						resetQueue.push(lit);
 						resetQueue.unlock();
 					}
-				});
+				};
+				// rewritten clauses are appended to the OT in variable order
+				if (opts.deterministic) for (uint32 v = 1; v <= inf.maxVar; v++) replace(v);
+				else workerPool.doWorkForEach((uint32)1, inf.maxVar + 1, replace);
 				workerPool.join();
+				ig.commit(workerPool);
 
 				delete[] scc;
 				if (!newEdge || sccReset) sccScan = false;
@@ -221,6 +211,12 @@ void ParaFROST::IGR()
 
 			if (sccReset) { continue; }
 
+			// Transitive reduction using interval labels
+			if (opts.igr_labels && !opts.hbr_en && IGTR()) {
+				if (trail.size() == sp->propagated) done = true;
+				continue;
+			}
+
 			if (opts.profile_simp) timer.pstart();
 
 			// Reset SCC ancestor nodes.
@@ -256,7 +252,7 @@ void ParaFROST::IGR()
 						ig[lit].markUnexplored();
 
 						// Queue parents for reset.
-						Vec<Edge>& ps = ig[lit].parents();
+						const EdgeRange ps = ig.parents(lit);
 						if (!ps.empty()) {
 							if (ps.size() > 1) {
 								std::unique_lock lock(resetMutex);
@@ -286,7 +282,7 @@ void ParaFROST::IGR()
 				if (!ig[lit].isExplored()) {
 					bool explore = true;
 					bool deadEnd = true;
-					Vec<Edge>& cs = ig[lit].children();
+					const EdgeRange cs = ig.children(lit);
 					ig[lit].lockRead();
 
 					for (uint32 i = 0; i < cs.size(); i++) {
@@ -304,7 +300,7 @@ void ParaFROST::IGR()
 						}
 					}
 
-					if (deadEnd && ig[lit].isOrphan()) {
+					if (deadEnd && ig.isOrphan(lit)) {
 						ig[lit].markExplored(); // nothing to do for this node
 					}
 					else if (explore) {
@@ -329,7 +325,8 @@ void ParaFROST::IGR()
 
 			if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[7] += timer.pcpuTime(), timer.pstart();
 
-			workerPool.doWork([&] {
+			auto explore = [&] {
+				PFTRACE("IGR explore");
 				uint32 lit = 0;
 				uint32 ti = workerPool.getID();
 				assert(ti >= 0);
@@ -355,11 +352,6 @@ void ParaFROST::IGR()
 
 					ig[lit].lockRead();
 
-					uint32 flipLit = FLIP(lit);
-					Vec<Edge>& ps = ig[lit].parents();
-					Vec<Edge>& cs = ig[lit].children();
-					uVec1D& ds = ig[lit].descendants();
-
 					// If the node got reduced, check the reference.
 					while (ig[lit].isReduced()) {
 						uint32 newLit = ig[lit].descendants()[0];
@@ -368,6 +360,11 @@ void ParaFROST::IGR()
 						ig[lit].lockRead();
 					}
 
+					uint32 flipLit = FLIP(lit);
+					const EdgeRange ps = ig.parents(lit);
+					const EdgeRange cs = ig.children(lit);
+					uVec1D& ds = ig[lit].descendants();
+
 					// Early return. Nothing left to do.
 					if (ig[lit].isExplored()) { ig[lit].unlockRead(); lit = 0; continue; }
 
@@ -410,16 +407,18 @@ void ParaFROST::IGR()
 
 							// Gather descendants.
 							if (!redundant) {
-								uVec1D grandchildren;
-								auto& gcs = ig[c].children();
+								SCRATCH& sc = scratch();
+								uVec1D& grandchildren = sc.nodes;
+								grandchildren.clear();
+								const EdgeRange gcs = ig.children(c);
 								for (uint32 i = 0; i < gcs.size(); i++) {
 									if (!gcs[i].second->deleted()) {
 										grandchildren.push(gcs[i].first);
 									}
 								}
 
-								ig[lit].descendants().unionize(grandchildren);
-								ig[lit].descendants().unionize(ig[c].descendants());
+								ig[lit].descendants().unionize(grandchildren, sc.merged, std::less<uint32>());
+								ig[lit].descendants().unionize(ig[c].descendants(), sc.merged, std::less<uint32>());
 							}
 
 							ig[c].unlockRead();
@@ -447,7 +446,7 @@ void ParaFROST::IGR()
 								}
 
 								if (cnfstate == UNSOLVED) {
-									Vec<Edge>& units = ig[flipLit].children();
+									const EdgeRange units = ig.children(flipLit);
 									for (uint32 j = 0; j < units.size(); j++) {
 										if (unassigned(units[j].first)) enqueueOrg(units[j].first);
 										else if (isFalse(units[j].first)) { cnfstate = UNSAT; exploreCV.notify_all(); }
@@ -469,7 +468,7 @@ void ParaFROST::IGR()
 					}
 
 					// Hyper-Binary-Resolution
-					if (opts.hbr_en && hbrRetries != 0) {
+					if (opts.hbr_en && hbrRetries != 0 && stats.n_simpticks < lrn.simp_ticks_max) {
 						ig[lit].unlock();
 
 						// Compute transitive closure
@@ -488,6 +487,7 @@ void ParaFROST::IGR()
 						// Compute propagation closure
 						uVec1D propClosure, propQueue;
 						uint32 propIdx = 0;
+						int64 ticks = 0;
 						propClosure.copyFrom(transClosure);
 						propQueue.copyFrom(transClosure);
 
@@ -495,10 +495,12 @@ void ParaFROST::IGR()
 							uint32 assign = propQueue[propIdx++];
 							uint32 f_assign = FLIP(assign);
 							assert(assign > 1);
+							ticks += 1 + cacheLines(ot[f_assign].size() * sizeof(S_REF));
 
 							// reduce unsatisfied
 							for (int i = 0; i < ot[f_assign].size(); i++) {
 								S_REF& c = ot[f_assign][i];
+								ticks++;
 								if (c->deleted()) continue;
 								uint32 unitLit = 0;
 
@@ -530,6 +532,7 @@ void ParaFROST::IGR()
 
 							if (exploreTerminate) break;
 						}
+						stats.n_simpticks += ticks;
 
 						if (exploreTerminate || cnfstate == UNSAT) { lit = 0; continue; }
 
@@ -577,7 +580,15 @@ void ParaFROST::IGR()
 					ig[lit].unlock();
 					lit = newLit;
 				}
-			});
+			};
+			// exploring from a single worker fixes the order of edge
+			// removals, failed literals and hyper-binary resolvents
+			if (opts.deterministic) {
+				std::sort(exploreQueue.data(), exploreQueue.end());
+				exploreWorking = 1;
+				workerPool.doWorkForEach((uint32)0, (uint32)1, (uint32)1, [&](uint32) { explore(); });
+			}
+			else workerPool.doWork(explore);
 			workerPool.join();
 
 			// Add new clauses to CNF
@@ -591,6 +602,7 @@ void ParaFROST::IGR()
 				}
 				newClauses[i].clear(true);
 			}
+			ig.commit(workerPool);
 
 			if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[8] += timer.pcpuTime();
 
@@ -607,15 +619,15 @@ void ParaFROST::IGR()
 				std::unique_lock lock(printMutex);
 				printf("ig[%d]:\n", i);
 				printf("\tparents: ");
-				for (uint32 j = 0; j < ig[i].parents().size(); j++) {
-					if (!ig[i].parents()[j].second->deleted()) {
-						printf("%d, ", ig[i].parents()[j].first);
+				for (uint32 j = 0; j < ig.parents(i).size(); j++) {
+					if (!ig.parents(i)[j].second->deleted()) {
+						printf("%d, ", ig.parents(i)[j].first);
 					}
 				}
 				printf("\n\tchildren: ");
-				for (uint32 j = 0; j < ig[i].children().size(); j++) {
-					if (!ig[i].children()[j].second->deleted()) {
-						printf("%d, ", ig[i].children()[j].first);
+				for (uint32 j = 0; j < ig.children(i).size(); j++) {
+					if (!ig.children(i)[j].second->deleted()) {
+						printf("%d, ", ig.children(i)[j].first);
 					}
 				}
 				printf("\n\tdescendants: ");
@@ -638,15 +650,20 @@ void ParaFROST::IGR()
 
 void ParaFROST::CE()
 {
+	PFTRACE("CE");
 	if (phase == 0 && opts.ce_en && (opts.hse_en || opts.bce_en)) {
 		if (interrupted()) killSolver();
 		PFLOGN2(2, "  Eliminating clauses..");
 		if (opts.profile_simp) timer.pstart();
 
-		workerPool.doWorkForEach((size_t)0, scnf.size(), (size_t)64, [this](size_t i) {
-			clause_elim(scnf[i], ot, ig);
-		});
-		workerPool.join();
+		if (opts.deterministic) orderedCE();
+		else {
+			workerPool.doWorkForEach((size_t)0, scnf.size(), (size_t)64, [this](size_t i) {
+				clause_elim(scnf[i], ot, ig);
+			});
+			workerPool.join();
+		}
+		reduceOT(); // gate definitions must not see eliminated clauses
 
 		if (opts.profile_simp) timer.pstop(), timer.ce += timer.pcpuTime();
 		PFLDONE(2, 5);
@@ -654,8 +671,55 @@ void ParaFROST::CE()
 	}
 }
 
+// Same as 'clause_elim' over all clauses, but the checks run in parallel
+// against the formula as it was before CE and the removals are applied
+// afterwards in clause order, so the outcome is independent of timing
+void ParaFROST::orderedCE()
+{
+	typedef std::pair<size_t, S_REF> RSE_PAIR;
+	std::vector<std::vector<RSE_PAIR>> pairs(workerPool.count());
+	if (opts.hse_en) {
+		workerPool.doWorkForEach((size_t)0, scnf.size(), (size_t)64, [&](size_t i) {
+			const S_REF c = scnf[i];
+			if (c->deleted() || c->size() > opts.rse_max) return;
+			OL& subsumed = scratch().subsumed;
+			rse_collect(c, ot, ig, subsumed);
+			std::vector<RSE_PAIR>& tpairs = pairs[workerPool.getID()];
+			for (int k = 0; k < subsumed.size(); k++) tpairs.push_back(RSE_PAIR(i, subsumed[k]));
+		});
+		workerPool.join();
+		std::vector<RSE_PAIR> all;
+		for (uint32 t = 0; t < pairs.size(); t++) {
+			all.insert(all.end(), pairs[t].begin(), pairs[t].end());
+			std::vector<RSE_PAIR>().swap(pairs[t]);
+		}
+		std::sort(all.begin(), all.end(), [](const RSE_PAIR& a, const RSE_PAIR& b) {
+			return a.first < b.first || (a.first == b.first && a.second->id() < b.second->id());
+		});
+		for (size_t k = 0; k < all.size(); k++) {
+			const S_REF c = scnf[all[k].first], d = all[k].second;
+			if (c->deleted() || d->deleted()) continue;
+			if (d->original()) c->set_status(ORIGINAL);
+			if (c->size() < d->size()) d->markDeleted();
+		}
+	}
+	if (opts.bce_en) {
+		std::vector<SCNF> blocked(workerPool.count());
+		workerPool.doWorkForEach((size_t)0, scnf.size(), (size_t)64, [&](size_t i) {
+			const S_REF c = scnf[i];
+			if (!c->deleted() && !c->learnt() && c->size() > 2 && clause_blocked(c, ot))
+				blocked[workerPool.getID()].push(c);
+		});
+		workerPool.join();
+		for (uint32 t = 0; t < blocked.size(); t++)
+			for (size_t k = 0; k < blocked[t].size(); k++)
+				blocked[t][k]->markDeleted();
+	}
+}
+
 void ParaFROST::BVE()
 {
+	PFTRACE("BVE");
 	if (opts.ve_en) {
 		if (interrupted()) killSolver();
 		PFLOGN2(2, "  Eliminating variables..");
@@ -664,13 +728,16 @@ void ParaFROST::BVE()
 		std::vector<uVec1D> resolved(PVs.size());
 		std::vector<SCNF> new_res(PVs.size());
 
-		workerPool.doWorkForEach((uint32)0, PVs.size(), (uint32)1, [&](uint32 i) {
+		// variables with too many resolution pairs are resolved
+		// afterwards, one at a time, with the pairs split over workers
+		const bool split = opts.ve_split && workerPool.count() > 1;
+		auto heavy = [&](const uint32& v) { return split && resPairs(v) >= opts.ve_split; };
+		auto eliminate = [&](const uint32& i, const bool& splitting) {
 			uint32& v = PVs[i];
 			assert(v);
 			assert(sp->vstate[v] == ACTIVE);
 
-			Lits_t out_c;
-			out_c.reserve(INIT_CAP);
+			Lits_t& out_c = scratch().lits;
 			uint32 p = V2L(v), n = NEG(p);
 			OL& poss = ot[p], & negs = ot[n];
 			int pOrgs = 0, nOrgs = 0;
@@ -716,13 +783,23 @@ void ParaFROST::BVE()
 					sp->vstate[v] = MELTED, v = 0;
 				}
 				// n-by-m resolution
-				else if (resolve_x(v, pOrgs, nOrgs, poss, negs, out_c, new_res[i], false)) {
+				else if (splitting ? resolve_x_split(v, pOrgs, nOrgs, poss, negs, new_res[i], false)
+					: resolve_x(v, pOrgs, nOrgs, poss, negs, out_c, new_res[i], false)) {
 					toblivion(p, pOrgs, nOrgs, poss, negs, resolved[i]);
 					sp->vstate[v] = MELTED, v = 0;
 				}
 			}
+		};
+		forEachPV([&](uint32 i) {
+			if (!heavy(PVs[i])) eliminate(i, false);
 		});
-		workerPool.join();
+		if (split) {
+			// the split jobs charge their ticks themselves
+			const int64 before = simpTicks;
+			for (uint32 i = 0; i < PVs.size(); i++)
+				if (PVs[i] && heavy(PVs[i])) eliminate(i, true);
+			stats.n_simpticks += simpTicks - before;
+		}
 
 		uint32 resCount = 0;
 		for (uint32 i = 0; i < PVs.size(); i++) {
@@ -753,12 +830,13 @@ void ParaFROST::BVE()
 
 void ParaFROST::HSE()
 {
+	PFTRACE("HSE");
 	if (!opts.ce_en && (opts.hse_en || opts.ve_plus_en)) {
 		if (interrupted()) killSolver();
 		PFLOGN2(2, "  Eliminating (self)-subsumptions..");
 		if (opts.profile_simp) timer.pstart();
 
-		workerPool.doWorkForEach((uint32)0, PVs.size(), (uint32)1, [&](uint32 i) {
+		forEachPV([&](uint32 i) {
 			uint32 v = PVs[i];
 			assert(v);
 			assert(sp->vstate[v] == ACTIVE);
@@ -766,7 +844,6 @@ void ParaFROST::HSE()
 			if (ot[p].size() <= opts.hse_limit && ot[n].size() <= opts.hse_limit)
 				self_sub_x(p, ot[p], ot[n]);
 		});
-		workerPool.join();
 
 		if (opts.profile_simp) timer.pstop(), timer.hse += timer.pcpuTime();
 		PFLDONE(2, 5);
@@ -776,19 +853,19 @@ void ParaFROST::HSE()
 
 void ParaFROST::BCE()
 {
+	PFTRACE("BCE");
 	if (!opts.ce_en && opts.bce_en) {
 		if (interrupted()) killSolver();
 		PFLOGN2(2, " Eliminating blocked clauses..");
 		if (opts.profile_simp) timer.pstart();
 
-		workerPool.doWorkForEach((uint32)0, PVs.size(), (uint32)1, [&](uint32 i) {
+		forEachPV([&](uint32 i) {
 			uint32 v = PVs[i];
 			if (!v) return;
 			uint32 p = V2L(v), n = NEG(p);
 			if (ot[p].size() <= opts.bce_limit && ot[n].size() <= opts.bce_limit)
 				blocked_x(v, ot[n], ot[p]);
 		});
-		workerPool.join();
 
 		if (opts.profile_simp) timer.pstop(), timer.bce += timer.pcpuTime();
 		PFLDONE(2, 5);
@@ -798,18 +875,31 @@ void ParaFROST::BCE()
 
 void ParaFROST::ERE()
 {
+	PFTRACE("ERE");
 	if (!opts.ere_en) return;
+	if (memPressure()) {
+		PFLOG2(1, " Memory limit: skipping ERE");
+		stats.memsqueezes++;
+		return;
+	}
 	if (interrupted()) killSolver();
 	PFLOGN2(2, " Eliminating redundances..");
 	if (opts.profile_simp) timer.pstart();
-
-	workerPool.doWorkForEach((uint32)0, PVs.size(), (uint32)1, [&](uint32 i) {
+	// ERE runs once per sigmification, after the other stages, so the
+	// index is built here rather than kept up to date by all of them
+	CHASH index;
+	const bool hashed = opts.ere_hash && checkMem("ERE index", CHASH::bytes(scnf.size()));
+	if (hashed) index.build(scnf, workerPool, MAX_ERE_OUT, opts.deterministic);
+	for (SCRATCH& s : scratches) s.hits = s.misses = 0;
+
+	forEachPV([&](uint32 i) {
 		uint32 v = PVs[i];
 		assert(v);
 		uint32 p = V2L(v);
 		OL& poss = ot[p], & negs = ot[NEG(p)];
-		Lits_t m_c;
-		m_c.reserve(INIT_CAP);
+		SCRATCH& sc = scratch();
+		Lits_t& m_c = sc.lits;
+		m_c.clear();
 
 		if (ot[p].size() <= opts.ere_limit && ot[NEG(p)].size() <= opts.ere_limit) {
 			// do merging and apply forward equality check (on-the-fly) over resolvents
@@ -817,23 +907,61 @@ void ParaFROST::ERE()
 				if (poss[i]->deleted()) continue;
 				for (int j = 0; j < negs.size(); j++) {
 					if (negs[j]->deleted() || (poss[i]->size() + negs[j]->size() - 2) > MAX_ERE_OUT) continue;
-					if (merge_ere(PVs[i], poss[i], negs[j], m_c)) {
+					if (merge_ere(v, poss[i], negs[j], m_c)) {
 						CL_ST type;
 						if (poss[i]->learnt() || negs[j]->learnt()) type = LEARNT;
 						else type = ORIGINAL;
-						if (m_c.size() > 1) forward_equ(m_c, ot, type);
+						if (m_c.size() > 1) {
+							if (hashed) forward_equ(m_c, index, type) ? sc.hits++ : sc.misses++;
+							else forward_equ(m_c, ot, type);
+						}
 					}
 				}
 			}
 		}
 	});
-	workerPool.join();
 
 	if (opts.profile_simp) timer.pstop(), timer.ere += timer.pcpuTime();
-	PFLDONE(2, 5);
+	if (hashed) {
+		int64 hits = 0, misses = 0;
+		for (const SCRATCH& s : scratches) hits += s.hits, misses += s.misses;
+		stats.n_erehits += hits, stats.n_eremisses += misses;
+		PFLENDING(2, 5, "(%lld hits, %lld misses)", hits, misses);
+		index.clear();
+	}
+	else PFLDONE(2, 5);
 	PFLREDCL(this, 2, "ERE Reductions");
 }
 
+// Clauses are grouped by the hash of their literal sets and equal ones
+// within a group are removed, a learnt copy of an original is promoted
+uint32 ParaFROST::DCE()
+{
+	PFTRACE("DCE");
+	if (!opts.dce_en || cnfstate == UNSAT) return 0;
+	if (interrupted()) killSolver();
+	if (!checkMem("DCE index", CHASH::bytes(scnf.size()))) return 0;
+	PFLOGN2(2, " Eliminating duplicates..");
+	if (opts.profile_simp) timer.pstart();
+	CHASH index;
+	index.build(scnf, workerPool, INT32_MAX, opts.deterministic);
+	std::atomic<uint32> removed(0);
+	workerPool.doWorkForEach((size_t)0, index.buckets(), [&](size_t b) {
+		index.forEachPair(b, [&](const S_REF c, const S_REF d) {
+			if (c->deleted() || d->deleted() || c->size() != d->size() || !isEqual(*c, *d)) return;
+			if (c->learnt() && d->original()) c->set_status(ORIGINAL);
+			d->markDeleted();
+			removed++;
+		});
+	});
+	workerPool.join();
+	index.clear();
+	stats.n_duplicates += removed;
+	if (opts.profile_simp) timer.pstop(), timer.dce += timer.pcpuTime();
+	PFLENDING(2, 5, "(%d removed)", (uint32)removed);
+	return removed;
+}
+
 bool ParaFROST::propClause(S_REF c, const uint32& f_assign)
 {
 	uint32 sig = 0;
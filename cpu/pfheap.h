@@ -108,6 +108,138 @@ namespace pFROST {
 		
 	};
 
+	/*****************************************************/
+	/*  Usage: d-ary max-heap over variable activities   */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	// Every node keeps a copy of the activity of its variable, so
+	// sifting compares nodes without going through 'act'. Ties go
+	// to the smaller variable as in HEAP_CMP. The root sits at slot
+	// 'ARITY - 1' of an aligned buffer, so the children of any node
+	// start a group of their own; with the default 4 a group fills
+	// exactly one cache line. The keys must be refreshed whenever
+	// all activities are rescaled
+	template <int ARITY = 4>
+	class DHEAP {
+		struct NODE {
+			double	act;
+			uint32	var;
+		};
+		static const uint32 LINE = 64, ROOT = ARITY - 1;
+		static const uint32 GROUP = ARITY * sizeof(NODE), ALIGN = GROUP > LINE ? GROUP : LINE;
+		static_assert(ARITY >= 2 && !(ARITY & (ARITY - 1)), "heap arity must be a power of two");
+		void*				raw;
+		NODE*				nodes; // 'nodes + ROOT' is the root
+		uint32				sz, cap;
+		uVec1D				pos;
+		const Vec<double>&	act;
+		__forceinline static bool	less		(const NODE& x, const NODE& y) {
+			if (x.act < y.act) return true;
+			if (x.act > y.act) return false;
+			return x.var > y.var;
+		}
+		__forceinline NODE&		node		(const uint32& i) { return nodes[i + ROOT]; }
+		__forceinline void		place		(const uint32& i, const NODE& x) { node(i) = x, pos[x.var] = i; }
+		inline void				grow		() {
+			const uint32 newCap = cap ? (cap << 1) : LINE;
+			const size_t bytes = (size_t(newCap) + ROOT) * sizeof(NODE);
+			void* newRaw = NULL;
+			pfalloc(newRaw, bytes + ALIGN);
+			NODE* newNodes = (NODE*)(((size_t)newRaw + ALIGN - 1) & ~size_t(ALIGN - 1));
+			if (sz) std::memcpy(newNodes + ROOT, nodes + ROOT, sz * sizeof(NODE));
+			std::free(raw);
+			memAccount.account(MEM_OTHER, (int64(newCap) - int64(cap)) * int64(sizeof(NODE)));
+			raw = newRaw, nodes = newNodes, cap = newCap;
+		}
+		__forceinline void		siftUp		(uint32 i) {
+			const NODE x = node(i);
+			while (i) {
+				const uint32 p = (i - 1) / ARITY;
+				if (!less(node(p), x)) break;
+				place(i, node(p));
+				i = p;
+			}
+			place(i, x);
+		}
+		__forceinline void		siftDown	(uint32 i) {
+			const NODE x = node(i);
+			while (true) {
+				const uint32 first = i * ARITY + 1;
+				if (first >= sz) break;
+				// the grandchildren are the next 'ARITY' groups in a row
+				const uint32 next = first * ARITY + 1;
+				if (next < sz) {
+					const char* line = (const char*)&node(next);
+#if _WIN32
+					for (uint32 l = 0; l < ARITY * GROUP; l += LINE) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, line + l);
+#else
+					for (uint32 l = 0; l < ARITY * GROUP; l += LINE) __builtin_prefetch(line + l, 0, 1);
+#endif
+				}
+				const uint32 last = first + ARITY < sz ? first + ARITY : sz;
+				uint32 best = first;
+				for (uint32 c = first + 1; c < last; c++)
+					if (less(node(best), node(c))) best = c;
+				if (!less(x, node(best))) break;
+				place(i, node(best));
+				i = best;
+			}
+			place(i, x);
+		}
+	public:
+								DHEAP		(const Vec<double>& _act) : raw(NULL), nodes(NULL), sz(0), cap(0), act(_act) {}
+								~DHEAP		() { destroy(); }
+		__forceinline uint32	top			() { assert(!empty()); return node(0).var; }
+		__forceinline uint32	size		() const { return sz; }
+		__forceinline bool		empty		() const { return !sz; }
+		__forceinline uint32	operator[]	(const uint32& i) { assert(i < sz); return node(i).var; }
+		__forceinline bool		has			(const uint32& x) const { return pos.size() > x && pos[x] != ILLEGAL_POS; }
+		__forceinline uint32	pop			() {
+			assert(!empty());
+			const uint32 top_x = node(0).var;
+			const NODE last = node(--sz);
+			pos[top_x] = ILLEGAL_POS;
+			if (sz) place(0, last), siftDown(0);
+			return top_x;
+		}
+		__forceinline void		bump		(const uint32& x) { if (has(x)) update(x); }
+		__forceinline void		update		(const uint32& x) {
+			assert(has(x));
+			const uint32 i = pos[x];
+			node(i).act = act[x];
+			siftUp(i);
+			siftDown(pos[x]);
+		}
+		__forceinline void		insert		(const uint32& x) {
+			pos.expand(x + 1, ILLEGAL_POS);
+			assert(!has(x));
+			if (sz == cap) grow();
+			node(sz) = { act[x], x };
+			pos[x] = sz;
+			siftUp(sz++);
+		}
+		// reload the keys after all activities were scaled by the same
+		// factor; the order is kept, so the heap needs no repair
+		__forceinline void		refresh		() {
+			for (uint32 i = 0; i < sz; i++) node(i).act = act[node(i).var];
+		}
+		__forceinline void		clear		() {
+			for (uint32 i = 0; i < sz; i++) pos[node(i).var] = ILLEGAL_POS;
+			sz = 0;
+		}
+		__forceinline void		destroy		() {
+			std::free(raw);
+			memAccount.account(MEM_OTHER, -int64(cap) * int64(sizeof(NODE)));
+			raw = NULL, nodes = NULL, sz = 0, cap = 0;
+			pos.clear(true);
+		}
+		__forceinline void		rebuild		(uVec1D& vars) {
+			destroy();
+			for (uint32 i = 0; i < vars.size(); i++)
+				insert(vars[i]);
+		}
+	};
+
 }
 
 #endif
\ No newline at end of file
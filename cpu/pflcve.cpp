@@ -32,7 +32,7 @@ void ParaFROST::varReorder()
 	histSimp(scnf, true);
 	uint32* scores = sp->tmp_stack;
 	for (uint32 v = 1; v <= inf.maxVar; v++) eligible[v - 1] = v, scores[v] = rscore(v);
-	rSort(eligible, LCV_CMP(scores), LCV_RANK(scores));
+	rSort(eligible, LCV_CMP(scores), LCV_RANK(scores), workerPool);
 
 	if (opts.profile_simp) timer.pstop(), timer.vo += timer.pcpuTime();
 	PFLDONE(2, 5);
@@ -47,8 +47,10 @@ void ParaFROST::varReorder()
 
 bool ParaFROST::LCVE()
 {
+	PFTRACE("LCVE");
 	// reorder variables
 	varReorder();
+	if (opts.lcve_colors > 1) return colorLCVE();
 	// extended LCVE
 	PFLOGN2(2, " Electing variables in phase-%d..", phase);
 	PVs.clear();
@@ -81,6 +83,150 @@ bool ParaFROST::LCVE()
 	return true;
 }
 
+// Jones-Plassmann coloring of the candidates (ranked by occurrences) over
+// the variable-clause incidence graph, each color is an independent set
+// eliminated in a separate round of the same phase
+bool ParaFROST::colorLCVE()
+{
+	PFLOGN2(2, " Coloring variables in phase-%d..", phase);
+	const uint32 pos_temp = opts.mu_pos << mu_inc, neg_temp = opts.mu_neg << mu_inc;
+	const uint32 maxColors = opts.lcve_colors, NOCOLOR = maxColors + 1;
+	uVec1D cands, rank(inf.maxVar + 1, 0);
+	for (uint32 i = 0; i < eligible.size(); i++) {
+		uint32 cand = eligible[i];
+		assert(cand && cand <= inf.maxVar);
+		if (sp->vstate[cand] == FROZEN || sp->vstate[cand] == MELTED) continue;
+		if (occurs[cand].ps == 0 && occurs[cand].ns == 0) continue;
+		uint32 p = V2L(cand), n = NEG(p);
+		if ((uint32)ot[p].size() >= pos_temp && (uint32)ot[n].size() >= neg_temp) break;
+		assert(sp->vstate[cand] == ACTIVE);
+		cands.push(cand);
+		rank[cand] = cands.size();
+	}
+	// a candidate is colored once all its higher-ranked neighbours are,
+	// with the least color not taken by them (NOCOLOR if all taken)
+	std::vector<std::atomic<uint32>> colors(inf.maxVar + 1);
+	auto colorVar = [&](const uint32& v) {
+		const uint32 r = rank[v], p = V2L(v);
+		uint64 taken = 0;
+		for (uint32 l = p; l <= NEG(p); l++) {
+			const OL& ol = ot[l];
+			for (int i = 0; i < ol.size(); i++) {
+				const SCLAUSE& c = *ol[i];
+				if (c.deleted()) continue;
+				for (int k = 0; k < c.size(); k++) {
+					const uint32 u = ABS(c[k]);
+					if (u == v || !rank[u] || rank[u] > r) continue;
+					const uint32 cu = colors[u].load();
+					if (!cu) return false;
+					if (cu < NOCOLOR) taken |= 1ULL << (cu - 1);
+				}
+			}
+		}
+		uint32 cv = 1;
+		while (cv < NOCOLOR && ((taken >> (cv - 1)) & 1)) cv++;
+		colors[v] = cv;
+		return true;
+	};
+	uVec1D pending(cands);
+	while (pending.size()) {
+		workerPool.doWorkForEach((uint32)0, pending.size(), [&](uint32 i) {
+			if (colorVar(pending[i])) pending[i] = 0;
+		});
+		workerPool.join();
+		uint32 n = 0;
+		for (uint32 i = 0; i < pending.size(); i++)
+			if (pending[i]) pending[n++] = pending[i];
+		// long dependency chains: finish the rest in rank order
+		if (n && (pending.size() - n) < (pending.size() >> 3)) {
+			for (uint32 i = 0; i < n; i++) {
+				bool colored = colorVar(pending[i]);
+				assert(colored), (void)colored;
+			}
+			n = 0;
+		}
+		pending.resize(n);
+	}
+	// group candidates by color preserving their ranks
+	colorEnds.clear(), colorEnds.resize(maxColors + 1, 0);
+	for (uint32 i = 0; i < cands.size(); i++) {
+		const uint32 cv = colors[cands[i]];
+		assert(cv && cv <= NOCOLOR);
+		if (cv < NOCOLOR) colorEnds[cv]++;
+	}
+	for (uint32 cv = 1; cv <= maxColors; cv++) colorEnds[cv] += colorEnds[cv - 1];
+	colorVars.resize(colorEnds[maxColors]);
+	uVec1D pos(colorEnds);
+	for (uint32 i = 0; i < cands.size(); i++) {
+		const uint32 cv = colors[cands[i]];
+		if (cv < NOCOLOR) colorVars[pos[cv - 1]++] = cands[i];
+	}
+	uint32 nColors = 0;
+	while (nColors < maxColors && colorEnds[nColors + 1] > colorEnds[nColors]) nColors++;
+	PVs.clear(), colorIdx = 0, otTail = scnf.size();
+	for (uint32 i = colorEnds[0]; i < colorEnds[1]; i++) PVs.push(colorVars[i]);
+	PFLENDING(2, 5, "(%d elected, %d colors)", PVs.size(), nColors);
+	if (verbose >= 3) { PFLOGN0(" PLCVs "); printVars(PVs, PVs.size(), 'v'); }
+	assert(verifyLCVE());
+	if (PVs.size() < opts.lcve_min) {
+		if (verbose > 1) PFLOGW("parallel variables not enough -> skip BVE");
+		return false;
+	}
+	return true;
+}
+
+// Elect the next color after attaching the resolvents of the previous
+// round to the OT; variables that share a clause with an earlier one
+// of the same color (through those resolvents) are deferred
+bool ParaFROST::nextColor()
+{
+	PFTRACE("nextColor");
+	if (opts.lcve_colors <= 1 || cnfstate == UNSAT) return false;
+	assert(colorEnds.size() == opts.lcve_colors + 1);
+	while (++colorIdx < opts.lcve_colors) {
+		const uint32 begin = colorEnds[colorIdx], end = colorEnds[colorIdx + 1];
+		if (begin == end) return false;
+		if (interrupted()) killSolver();
+		if (otTail < scnf.size()) {
+			workerPool.doWorkForEach((size_t)0, scnf.size() - otTail, [&](size_t i) {
+				const S_REF c = scnf[otTail + i];
+				if (c->deleted()) return;
+				for (int k = 0; k < c->size(); k++) {
+					assert(c->lit(k) > 1);
+					ot[c->lit(k)].lock();
+					ot[c->lit(k)].push(c);
+					ot[c->lit(k)].unlock();
+				}
+			});
+			workerPool.join();
+			if (opts.deterministic) orderOT();
+			otTail = scnf.size();
+		}
+		PVs.clear();
+		for (uint32 i = begin; i < end; i++) {
+			const uint32 v = colorVars[i];
+			if (sp->vstate[v] != ACTIVE || sp->frozen[v]) continue;
+			const uint32 p = V2L(v);
+			PVs.push(v);
+			depFreeze(ot[p], v, UINT32_MAX, UINT32_MAX);
+			depFreeze(ot[NEG(p)], v, UINT32_MAX, UINT32_MAX);
+		}
+		memset(sp->frozen, 0, inf.maxVar + 1ULL);
+		PFLOG2(2, " Electing color-%d in phase-%d (%d elected, %d deferred)", colorIdx, phase, PVs.size(), end - begin - PVs.size());
+		if (PVs.size() >= opts.lcve_min) {
+			// drop clauses removed by previous rounds from the elected lists
+			workerPool.doWorkForEach((uint32)0, PVs.size(), [&](uint32 i) {
+				const uint32 p = V2L(PVs[i]);
+				reduceOL(ot[p]);
+				reduceOL(ot[NEG(p)]);
+			});
+			workerPool.join();
+			return true;
+		}
+	}
+	return false;
+}
+
 inline void ParaFROST::depFreeze(const OL& ol, const uint32& cand, const uint32& p_temp, const uint32& n_temp)
 {
 	for (int i = 0; i < ol.size(); i++) {
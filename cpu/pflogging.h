@@ -207,14 +207,16 @@ inline void REPCH(const char& ch, const size_t& size, const size_t& off = 0) {
     if (verbose >= VERBOSITY) { \
         SOLVER->evalReds(); \
         PFLOG1("\t\t %s%s%s", CLBLUE, MESSAGE, CNORMAL); \
-        SOLVER->logReductions(); }
+        SOLVER->logReductions(); \
+        if (SOLVER->exporting()) SOLVER->recordReductions(MESSAGE); }
 
 #define PFLREDCL(SOLVER, VERBOSITY, MESSAGE) \
     if (verbose >= VERBOSITY) { \
         inf.n_del_vars_after = 0; \
         SOLVER->countAll(); \
         PFLOG1("\t\t %s%s%s", CLBLUE, MESSAGE, CNORMAL); \
-        SOLVER->logReductions(); }
+        SOLVER->logReductions(); \
+        if (SOLVER->exporting()) SOLVER->recordReductions(MESSAGE); }
 
 #define PFORGINF(SOLVER, CLS, LITS) \
     int64 CLS = SOLVER->stats.clauses.original; \
@@ -48,34 +48,34 @@ inline bool	ParaFROST::verifySeen() {
 
 inline void ParaFROST::pumpFrozenHeap(const uint32& lit)
 {
-	WL& ws = wt[lit];
-	if (ws.empty()) return;
 	uint32 v = ABS(lit);
 	assert(!sp->frozen[v]);
 	double norm_act = (double)sp->level[v] / lrn.numMDs;
-	for (WATCH* w = ws; w != ws.end(); w++) {
-		CLAUSE& c = cm[w->ref];
-		if (c.deleted()) continue;
-		uint32 frozen_w = ABS(c[0]) ^ ABS(c[1]) ^ v;
-		assert(frozen_w != v);
-		if (activity[frozen_w] == 0) varBumpHeap(frozen_w, norm_act);
+	for (const WL& ws : { wtBin[lit], wt[lit] }) {
+		for (WATCH* w = ws; w != ws.end(); w++) {
+			CLAUSE& c = cm[w->ref];
+			if (c.deleted()) continue;
+			uint32 frozen_w = ABS(c[0]) ^ ABS(c[1]) ^ v;
+			assert(frozen_w != v);
+			if (activity[frozen_w] == 0) varBumpHeap(frozen_w, norm_act);
+		}
 	}
 }
 
 inline void ParaFROST::pumpFrozenQue(const uint32& lit)
 {
-	WL& ws = wt[lit];
-	if (ws.empty()) return;
 	uint32 v = ABS(lit);
 	assert(!sp->frozen[v]);
-	for (WATCH* w = ws; w != ws.end(); w++) {
-		CLAUSE& c = cm[w->ref];
-		if (c.deleted()) continue;
-		uint32 frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
-		assert(frozen_v != v);
-		if (sp->frozen[frozen_v]) {
-			analyzed.push(frozen_v);
-			sp->frozen[frozen_v] = 0;
+	for (const WL& ws : { wtBin[lit], wt[lit] }) {
+		for (WATCH* w = ws; w != ws.end(); w++) {
+			CLAUSE& c = cm[w->ref];
+			if (c.deleted()) continue;
+			uint32 frozen_v = ABS(c[0]) ^ ABS(c[1]) ^ v;
+			assert(frozen_v != v);
+			if (sp->frozen[frozen_v]) {
+				analyzed.push(frozen_v);
+				sp->frozen[frozen_v] = 0;
+			}
 		}
 	}
 }
@@ -118,8 +118,8 @@ void ParaFROST::varOrder()
 	hist(orgs, true);
 	uint32* scores = sp->tmp_stack;
 	for (uint32 v = 1; v <= inf.maxVar; v++) eligible[v - 1] = v, scores[v] = rscore(v);
-	if (opts.mdm_mcv_en) rSort(eligible, MCV_CMP(scores), MCV_RANK(scores));
-	else rSort(eligible, LCV_CMP(scores), LCV_RANK(scores));
+	if (opts.mdm_mcv_en) rSort(eligible, MCV_CMP(scores), MCV_RANK(scores), workerPool);
+	else rSort(eligible, LCV_CMP(scores), LCV_RANK(scores), workerPool);
 	PFLDONE(2, 5);
 	if (verbose >= 3) {
 		PFLOG0(" Eligible decisions:");
@@ -148,8 +148,8 @@ void ParaFROST::MDMInit()
 		assert(cand && cand <= inf.maxVar);
 		if (sp->frozen[cand] || sp->locked[cand]) continue;
 		uint32 p = V2L(cand), n = NEG(p);
-		uint32 dec = wt[p].size() >= wt[n].size() ? p : n;
-		if (valid(wt[dec]) && depFreeze(wt[dec], cand)) {
+		uint32 dec = wt[p].size() + wtBin[p].size() >= wt[n].size() + wtBin[n].size() ? p : n;
+		if (valid(wtBin[dec]) && valid(wt[dec]) && depFreeze(wtBin[dec], cand) && depFreeze(wt[dec], cand)) {
 			incDL();
 			enqueue(dec, DL());
 			sp->seen[cand] = 1;
@@ -171,6 +171,7 @@ void ParaFROST::MDMInit()
 
 void ParaFROST::MDM()
 {
+	PFTRACE("MDM");
 	assert(!satisfied());
 	assert(sp->propagated == trail.size());
 	assert(conflict == NOREF);
@@ -188,7 +189,7 @@ void ParaFROST::MDM()
 		assert(cand && cand <= inf.maxVar);
 		if (sp->frozen[cand] || sp->locked[cand]) continue;
 		uint32 dec = makeAssign(cand, useTarget());
-		if (valid(wt[dec]) && depFreeze(wt[dec], cand)) {
+		if (valid(wtBin[dec]) && valid(wt[dec]) && depFreeze(wtBin[dec], cand) && depFreeze(wt[dec], cand)) {
 			incDL();
 			enqueue(dec, DL());
 			sp->seen[cand] = 1;
@@ -206,7 +207,7 @@ void ParaFROST::MDM()
 	printStats(lrn.rounds == 0, 'm');
 }
 
-inline bool ParaFROST::valid(WL& ws)
+inline bool ParaFROST::valid(const WL& ws)
 {
 	WATCH* wend = ws.end();
 	for (WATCH* i = ws; i != wend; i++) {
@@ -233,7 +234,7 @@ inline bool ParaFROST::valid(WL& ws)
 	return true;
 }
 
-inline bool ParaFROST::depFreeze(WL& ws, const uint32& cand)
+inline bool ParaFROST::depFreeze(const WL& ws, const uint32& cand)
 {
 	WATCH* wend = ws.end();
 	for (WATCH* i = ws; i != wend; i++) {
@@ -287,7 +288,7 @@ void ParaFROST::eligibleVMFQ()
 		free = vmfq.previous(free);
 	}
 	assert(eligible.size() >= 1);
-	rSort(eligible, KEY_CMP_BUMP(bumps), KEY_RANK_BUMP(bumps));
+	rSort(eligible, KEY_CMP_BUMP(bumps), KEY_RANK_BUMP(bumps), workerPool);
 	PFLDONE(2, 5);
 	if (verbose >= 3) {
 		PFLOG0(" Eligible decisions:");
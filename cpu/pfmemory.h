@@ -0,0 +1,88 @@
+/***********************************************************************[pfmemory.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __MEMORY_
+#define __MEMORY_
+
+#include "pfdtypes.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace pFROST {
+
+	// allocation categories tracked by 'memAccount'
+	enum MEM_CAT : Byte { MEM_OTHER, MEM_CMM, MEM_WT, MEM_OT, MEM_IG, MEM_SCNF, MEM_SP, MEM_CATS };
+
+	// bytes a thread may hold back before publishing them
+	#define MEM_FLUSH 65536
+
+	// Live and peak bytes per allocation category. Every thread batches
+	// its deltas locally and publishes them with a relaxed atomic add once
+	// they exceed MEM_FLUSH bytes, so parallel allocators do not contend
+	// on the counters. Workers flush at the end of every job, so after
+	// a join the figures are exact (the calling thread's pending bytes
+	// are added in); peaks are sampled at publication
+	class MEMACCOUNT {
+		std::atomic<int64>	_live[MEM_CATS], _peak[MEM_CATS];
+		std::atomic<int64>	_total, _totalPeak;
+		inline static thread_local int64 _pending[MEM_CATS] = {};
+
+		inline static void		raise		(std::atomic<int64>& peak, const int64& val) {
+			int64 old = peak.load(std::memory_order_relaxed);
+			while (val > old && !peak.compare_exchange_weak(old, val, std::memory_order_relaxed));
+		}
+		inline void				publish		(const Byte& cat) {
+			const int64 delta = _pending[cat];
+			_pending[cat] = 0;
+			raise(_peak[cat], _live[cat].fetch_add(delta, std::memory_order_relaxed) + delta);
+			raise(_totalPeak, _total.fetch_add(delta, std::memory_order_relaxed) + delta);
+		}
+
+	public:
+		inline					MEMACCOUNT	() : _total(0), _totalPeak(0) {
+			for (int i = 0; i < MEM_CATS; i++) _live[i] = 0, _peak[i] = 0;
+		}
+		inline void				account		(const Byte& cat, const int64& bytes) {
+			assert(cat < MEM_CATS);
+			int64& pending = _pending[cat];
+			pending += bytes;
+			if (pending >= MEM_FLUSH || pending <= -MEM_FLUSH) publish(cat);
+		}
+		// publish what the calling thread holds back
+		inline void				flush		() { for (Byte i = 0; i < MEM_CATS; i++) if (_pending[i]) publish(i); }
+		inline int64			live		(const Byte& cat) const { return _live[cat].load(std::memory_order_relaxed) + _pending[cat]; }
+		inline int64			peak		(const Byte& cat) const { return std::max(_peak[cat].load(std::memory_order_relaxed), live(cat)); }
+		inline int64			total		() const {
+			int64 pending = 0;
+			for (int i = 0; i < MEM_CATS; i++) pending += _pending[i];
+			return _total.load(std::memory_order_relaxed) + pending;
+		}
+		inline int64			totalPeak	() const { return std::max(_totalPeak.load(std::memory_order_relaxed), total()); }
+		inline static const char* name		(const Byte& cat) {
+			static const char* names[MEM_CATS] = { "other", "clauses", "watches", "occurrences", "igraph", "simpclauses", "variables" };
+			assert(cat < MEM_CATS);
+			return names[cat];
+		}
+	};
+
+	inline MEMACCOUNT memAccount;
+
+}
+
+#endif
@@ -24,10 +24,10 @@ void ParaFROST::minimizeBin()
 {
 	markLearnt();
 	uint32 uip = FLIP(learntC[0]);
-	WL& ws = wt[uip];
+	WL ws = wtBin[uip];
 	int nLitsRem = 0;
 	for (WATCH* w = ws; w != ws.end(); w++) {
-		if (!w->binary()) continue;
+		assert(w->binary());
 		uint32 other = w->imp;
 		uint32 v = ABS(other);
 		if (sp->marks[v] == !SIGN(other)) {
@@ -19,7 +19,10 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include "pfvec.h"
-#include <shared_mutex>
+#include "pfsclause.h"
+#include "pfworker.h"
+#include <algorithm>
+#include <vector>
 
 namespace pFROST {
 	typedef std::pair<uint32, S_REF> Edge;
@@ -29,67 +32,44 @@ namespace pFROST {
 	static const NodeState _EXPLORED_ = 0x02;
 	static const NodeState _REDUCED_ = 0x04;
 
+	// Compact reader-writer spin lock
+	class NodeLock {
+		std::atomic<uint32> _s;
+		static const uint32 WRITER = 0x80000000;
+	public:
+		inline			NodeLock	() : _s(0) {}
+		inline void		lockRead	() {
+			while (true) {
+				uint32 s = _s.load(std::memory_order_relaxed);
+				if (!(s & WRITER) && _s.compare_exchange_weak(s, s + 1, std::memory_order_acquire)) return;
+				std::this_thread::yield();
+			}
+		}
+		inline void		unlockRead	() { _s.fetch_sub(1, std::memory_order_release); }
+		inline void		lock		() {
+			while (true) {
+				uint32 s = 0;
+				if (_s.compare_exchange_weak(s, WRITER, std::memory_order_acquire)) return;
+				std::this_thread::yield();
+			}
+		}
+		inline void		unlock		() { _s.store(0, std::memory_order_release); }
+	};
+
 	class Node {
 	protected:
-		Vec<Edge>					_out, _in;
 		uVec1D						_desc;
 		NodeState					_st;
-		mutable std::shared_mutex	_m;
-
-		inline void		appendEdge		(Vec<Edge>& vec, const uint32& lit, const S_REF& c) { vec.push(Edge(lit, c)); }
-		inline void		insertEdge		(Vec<Edge>& vec, const uint32& lit, const S_REF& c)
-		{
-			uint32 i = 0;
-			while (i < vec.size() && vec[i].first < lit) {
-				i++;
-			}
+		mutable NodeLock			_m;
 
-			if (i < vec.size() && vec[i].first == lit) return;
-			vec.push(Edge());
-
-			for (uint32 j = vec.size() - 1; j > i; j--) {
-				vec[j] = vec[j - 1];
-			}
-			
-			vec[i] = Edge(lit, c);
-		}
-		inline void		deleteEdge		(Vec<Edge>& vec, const uint32& lit)
-		{
-			uint32 n = 0;
-			for (uint32 i = 0; i < vec.size(); i++) {
-				if (vec[i].first != lit) vec[n++] = vec[i];
-			}
-			vec.resize(n);
-		}
-		inline bool		empty			(const Vec<Edge>& vec) const
-		{
-			bool retVal = true;
-			if (!vec.empty()) {
-				for (uint32 i = 0; i < vec.size(); i++) {
-					if (!vec[i].second->deleted()) {
-						retVal = false;
-						break;
-					}
-				}
-			}
-			return retVal;
-		}
 	public:
-		inline						Node			() { _st = 0; }
+		inline						Node			() { _st = 0; _desc.tag(MEM_IG); }
 		inline						~Node			() { clear(true); }
-		inline void					clear			(bool free = false) { _st = 0; _out.clear(free); _in.clear(free); _desc.clear(free); }
-		inline void					lockRead		() const { _m.lock_shared(); }
-		inline void					unlockRead		() const { _m.unlock_shared(); }
+		inline void					clear			(bool free = false) { _st = 0; _desc.clear(free); }
+		inline void					lockRead		() const { _m.lockRead(); }
+		inline void					unlockRead		() const { _m.unlockRead(); }
 		inline void					lock			() const { _m.lock(); }
 		inline void					unlock			() const { _m.unlock(); }
-		inline void					appendChild		(const uint32& lit, const S_REF& c) { appendEdge(_out, lit, c); }
-		inline void					insertChild		(const uint32& lit, const S_REF& c) { insertEdge(_out, lit, c); }
-		inline void					deleteChild		(const uint32& lit) { deleteEdge(_out, lit); }
-		inline void					appendParent	(const uint32& lit, const S_REF& c) { appendEdge(_in, lit, c); }
-		inline void					insertParent	(const uint32& lit, const S_REF& c) { insertEdge(_in, lit, c); }
-		inline void					deleteParent	(const uint32& lit) { deleteEdge(_in, lit); }
-		inline bool					isDeadEnd		() const { return empty(_out); }
-		inline bool					isOrphan		() const { return empty(_in); }
 		inline bool					isVisited		() const { return _st & _VISITED_; }
 		inline bool					isExplored		() const { return _st & _EXPLORED_; }
 		inline bool					isReduced		() const { return _st & _REDUCED_; }
@@ -99,15 +79,184 @@ namespace pFROST {
 		inline void					markUnvisited	() { _st &= ~_VISITED_; }
 		inline void					markUnexplored	() { _st &= ~_EXPLORED_; }
 		inline void					markUnreduced	() { _st &= ~_REDUCED_; }
-		inline Vec<Edge>&			children		() { return _out; }
-		inline const Vec<Edge>&		children		() const { return _out; }
-		inline Vec<Edge>&			parents			() { return _in; }
-		inline const Vec<Edge>&		parents			() const { return _in; }
 		inline uVec1D&				descendants		() { return _desc; }
 		inline const uVec1D&		descendants		() const { return _desc; }
-		inline void					sortEdges		() {
-			std::sort(_out.data(), _out.data() + _out.size());
-			std::sort(_in.data(), _in.data() + _in.size());
+	};
+
+	// A row of the adjacency arrays
+	class EdgeRange {
+		Edge*	_mem;
+		uint32	_sz;
+	public:
+		inline					EdgeRange	() : _mem(NULL), _sz(0) {}
+		inline					EdgeRange	(Edge* mem, const uint32& sz) : _mem(mem), _sz(sz) {}
+		inline Edge&			operator[]	(const uint32& i) const { assert(i < _sz); return _mem[i]; }
+		inline Edge*			data		() const { return _mem; }
+		inline Edge*			end			() const { return _mem + _sz; }
+		inline uint32			size		() const { return _sz; }
+		inline bool				empty		() const { return !_sz; }
+	};
+
+	// Implication graph stored as adjacency arrays (CSR) of children and parents,
+	// sorted by literal. New binaries are staged per thread without locking and
+	// merged in bulk by 'commit()'. Edges are deleted lazily, i.e. an edge is
+	// dropped once its clause is deleted or no longer the binary it was built from
+	class IGRAPH {
+		Node*					_nodes;
+		uint32					_nNodes;
+		Vec<size_t>				_outOff, _inOff;
+		uVec1D					_outSz, _inSz;
+		Vec<Edge, size_t>		_out, _in;
+		std::vector<Vec<S_REF, size_t>> _staged;
+
+		inline static bool		valid		(const uint32& from, const uint32& to, const S_REF& c) {
+			if (c->deleted() || c->size() != 2) return false;
+			const uint32 f = FLIP(from);
+			return (c->lit(0) == f && c->lit(1) == to) || (c->lit(1) == f && c->lit(0) == to);
+		}
+		// 'out' rows hold (child, c) and 'in' rows hold (parent, c)
+		inline void				merge		(WorkerPool& pool, Vec<size_t>& offs, uVec1D& sizes, Vec<Edge, size_t>& edges, const bool& out) {
+			const uint32 n = _nNodes;
+			std::vector<std::atomic<uint32>> count(n);
+			// drop invalid edges in place
+			pool.doWorkForEach((uint32)0, n, [&](uint32 lit) {
+				Edge* row = edges.data() + offs[lit];
+				uint32 k = 0;
+				for (uint32 i = 0; i < sizes[lit]; i++) {
+					const Edge& e = row[i];
+					if (out ? valid(lit, e.first, e.second) : valid(e.first, lit, e.second)) row[k++] = e;
+				}
+				sizes[lit] = k;
+				count[lit] = k;
+			});
+			pool.join();
+			for (uint32 t = 0; t < _staged.size(); t++) {
+				Vec<S_REF, size_t>& staged = _staged[t];
+				pool.doWorkForEach((size_t)0, staged.size(), [&](size_t i) {
+					const S_REF c = staged[i];
+					if (c->deleted() || c->size() != 2) return;
+					if (out) count[FLIP(c->lit(0))]++, count[FLIP(c->lit(1))]++;
+					else count[c->lit(0)]++, count[c->lit(1)]++;
+				});
+				pool.join();
+			}
+			Vec<size_t> newOffs(n + 1);
+			newOffs[0] = 0;
+			for (uint32 lit = 0; lit < n; lit++) newOffs[lit + 1] = newOffs[lit] + count[lit];
+			Vec<Edge, size_t> newEdges(newOffs[n]);
+			pool.doWorkForEach((uint32)0, n, [&](uint32 lit) {
+				std::copy(edges.data() + offs[lit], edges.data() + offs[lit] + sizes[lit], newEdges.data() + newOffs[lit]);
+				count[lit] = sizes[lit];
+			});
+			pool.join();
+			for (uint32 t = 0; t < _staged.size(); t++) {
+				Vec<S_REF, size_t>& staged = _staged[t];
+				pool.doWorkForEach((size_t)0, staged.size(), [&](size_t i) {
+					const S_REF c = staged[i];
+					if (c->deleted() || c->size() != 2) return;
+					const uint32 l0 = c->lit(0), l1 = c->lit(1);
+					if (out) {
+						newEdges[newOffs[FLIP(l0)] + count[FLIP(l0)]++] = Edge(l1, c);
+						newEdges[newOffs[FLIP(l1)] + count[FLIP(l1)]++] = Edge(l0, c);
+					}
+					else {
+						newEdges[newOffs[l1] + count[l1]++] = Edge(FLIP(l0), c);
+						newEdges[newOffs[l0] + count[l0]++] = Edge(FLIP(l1), c);
+					}
+				});
+				pool.join();
+			}
+			// sort rows and remove duplicate edges
+			pool.doWorkForEach((uint32)0, n, [&](uint32 lit) {
+				Edge* row = newEdges.data() + newOffs[lit];
+				const uint32 sz = count[lit];
+				if (sz > sizes[lit]) std::sort(row, row + sz, [](const Edge& a, const Edge& b) {
+					return a.first < b.first || (a.first == b.first && a.second->id() < b.second->id());
+				});
+				uint32 k = 0;
+				for (uint32 i = 0; i < sz; i++) {
+					if (!k || row[k - 1].first != row[i].first) row[k++] = row[i];
+				}
+				sizes[lit] = k;
+			});
+			pool.join();
+			edges.swap(newEdges), offs.swap(newOffs);
+		}
+
+		// nodes carry atomic lock words, so they are built in place once
+		// per size and never moved by a reallocation
+		inline void				freeNodes	() {
+			if (_nodes == NULL) return;
+			for (uint32 lit = 0; lit < _nNodes; lit++) _nodes[lit].~Node();
+			std::free(_nodes);
+			memAccount.account(MEM_IG, -int64(_nNodes) * int64(sizeof(Node)));
+			_nodes = NULL, _nNodes = 0;
+		}
+		inline void				allocNodes	(const uint32& n) {
+			assert(_nodes == NULL);
+			if (!n) return;
+			void* raw = NULL;
+			pfalloc(raw, size_t(n) * sizeof(Node));
+			_nodes = (Node*)raw;
+			for (uint32 lit = 0; lit < n; lit++) new (_nodes + lit) Node();
+			memAccount.account(MEM_IG, int64(n) * int64(sizeof(Node)));
+			_nNodes = n;
+		}
+
+	public:
+		inline					IGRAPH		() : _nodes(NULL), _nNodes(0) {
+			_out.tag(MEM_IG), _in.tag(MEM_IG);
+			_outOff.tag(MEM_IG), _inOff.tag(MEM_IG), _outSz.tag(MEM_IG), _inSz.tag(MEM_IG);
+		}
+		inline					~IGRAPH		() { clear(true); }
+		inline Node&			operator[]	(const uint32& lit) { assert(lit < _nNodes); return _nodes[lit]; }
+		inline const Node&		operator[]	(const uint32& lit) const { assert(lit < _nNodes); return _nodes[lit]; }
+		inline uint32			size		() const { return _nNodes; }
+		inline EdgeRange		children	(const uint32& lit) const { return EdgeRange(_out.data() + _outOff[lit], _outSz[lit]); }
+		inline EdgeRange		parents		(const uint32& lit) const { return EdgeRange(_in.data() + _inOff[lit], _inSz[lit]); }
+		inline bool				isDeadEnd	(const uint32& lit) const {
+			const EdgeRange cs = children(lit);
+			for (uint32 i = 0; i < cs.size(); i++) if (!cs[i].second->deleted()) return false;
+			return true;
+		}
+		inline bool				isOrphan	(const uint32& lit) const {
+			const EdgeRange ps = parents(lit);
+			for (uint32 i = 0; i < ps.size(); i++) if (!ps[i].second->deleted()) return false;
+			return true;
+		}
+		// detach a node from the graph (its neighbours drop their edges lazily)
+		inline void				isolate		(const uint32& lit) { _outSz[lit] = 0, _inSz[lit] = 0; }
+		inline void				resize		(const uint32& n, const uint32& threads) {
+			if (n != _nNodes) freeNodes(), allocNodes(n);
+			_outOff.resize(n + 1, 0), _inOff.resize(n + 1, 0);
+			_outSz.resize(n, 0), _inSz.resize(n, 0);
+			_staged.resize(threads + 1);
+			for (uint32 t = 0; t < _staged.size(); t++) _staged[t].tag(MEM_IG);
+		}
+		// stage binary 'c' for insertion by worker 'tid' (-1 for the main thread)
+		inline void				stage		(const S_REF& c, const int& tid) {
+			assert(c->size() == 2);
+			assert(tid + 1 < (int)_staged.size());
+			_staged[tid + 1].push(c);
+		}
+		inline bool				staged		() const {
+			for (uint32 t = 0; t < _staged.size(); t++) if (_staged[t].size()) return true;
+			return false;
+		}
+		// merge all staged binaries into the adjacency arrays
+		inline void				commit		(WorkerPool& pool) {
+			merge(pool, _outOff, _outSz, _out, true);
+			merge(pool, _inOff, _inSz, _in, false);
+			for (uint32 t = 0; t < _staged.size(); t++) _staged[t].clear();
+		}
+		inline void				clear		(const bool& free = false) {
+			if (free) freeNodes();
+			else for (uint32 lit = 0; lit < _nNodes; lit++) _nodes[lit].clear();
+			_out.clear(free), _in.clear(free);
+			_outOff.clear(free), _inOff.clear(free), _outSz.clear(free), _inSz.clear(free);
+			for (uint32 t = 0; t < _staged.size(); t++) _staged[t].clear(free);
+			if (free) _staged.clear();
 		}
+		inline static size_t	nodeBytes	() { return sizeof(Node) + 2 * (sizeof(size_t) + sizeof(uint32)); }
 	};
 }
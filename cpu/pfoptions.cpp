@@ -27,6 +27,8 @@ BOOL_OPT opt_ve_plus_en("ve+", "enable HSE + BVE", true);
 BOOL_OPT opt_hse_en("hse", "enable hybrid subsumption elimination", true);
 BOOL_OPT opt_bce_en("bce", "enable blocked clause elimination", false);
 BOOL_OPT opt_ere_en("ere", "enable eager redundancy elimination", true);
+BOOL_OPT opt_ere_hash("erehash", "look up ERE resolvents in a clause hash index instead of occurrence lists", true);
+BOOL_OPT opt_dce_en("dce", "enable duplicate clause elimination", true);
 BOOL_OPT opt_igr_en("igr", "enable impication graph reasoning", true);
 BOOL_OPT opt_fle_en("fle", "enable failed literal elimination", true);
 BOOL_OPT opt_hbr_en("hbr", "enable hyper-binary-resolution", false);
@@ -35,9 +37,13 @@ BOOL_OPT opt_ce_en("ce", "enable clause elimination stage", false);
 BOOL_OPT opt_all_en("all", "enable all simplifications", false);
 BOOL_OPT opt_profile_simp_en("profilesimp", "profile simplifications", false);
 BOOL_OPT opt_aggr_cnf_sort("aggresivesort", "sort simplified formula with aggresive key before writing to host", false);
+BOOL_OPT opt_cost_sched("costsched", "schedule per-variable simplifications longest-first in cost-guided chunks", true);
+BOOL_OPT opt_deterministic("deterministic", "make parallel simplifications reproducible for any number of workers", false);
 BOOL_OPT opt_solve_en("solve", "proceed with solving after simplifications", true);
 INT_OPT opt_lcve_min("lcvemin", "minimum parallel variables to simplify", 2, INT32R(1, INT32_MAX));
+INT_OPT opt_lcve_colors("lcvecolors", "set the maximum number of independent variable sets (colors) eliminated per phase (0 = single greedy set)", 4, INT32R(0, 64));
 INT_OPT opt_ve_phase_min("vephasemin", "minimum removed literals to stop stage1 reductions ", 500, INT32R(1, INT32_MAX));
+INT_OPT opt_ve_split("vesplit", "minimum resolution pairs of a variable to split its elimination over workers (0 = never)", 250000, INT32R(0, INT32_MAX));
 INT_OPT opt_mu_pos("mupos", "set the positive freezing temperature in LCVE", 32, INT32R(10, INT32_MAX));
 INT_OPT opt_mu_neg("muneg", "set the negative freezing temperature in LCVE", 32, INT32R(10, INT32_MAX));
 INT_OPT opt_xor_max_arity("xormaxarity", "maximum XOR fanin size", 20, INT32R(2, INT32_MAX));
@@ -47,6 +53,9 @@ INT_OPT opt_ere_max_occurs("eremax", "maximum occurrence list size to scan in ER
 INT_OPT opt_phases("phases", "set the number of phases in stage1 reductions", 5, INT32R(0, INT32_MAX));
 INT_OPT opt_cnf_free("gcfreq", "set the frequency of CNF memory shrinkage in SIGmA", 2, INT32R(0, 5));
 INT_OPT	opt_hbr_max("hbrmax", "set the maximum number of retries for hyper-binary-resolution", 10, INT32R(0, INT32_MAX));
+INT_OPT	opt_igr_labels("igrlabels", "set the number of interval labels per node for transitive reduction in IGR (0 = descendant sets)", 2, INT32R(0, 8));
+INT_OPT	opt_igr_effort("igreffort", "set the maximum nodes to visit per reachability query in IGR", 10000, INT32R(10, INT32_MAX));
+INT_OPT	opt_igr_label_mem("igrlabelmem", "set the memory budget (MB) for interval labels in IGR", 1024, INT32R(1, INT32_MAX));
 INT_OPT	opt_rse_max("rsemax", "set the maximum number of literals for a clause to be considered for reverse subsumption elimination", 10, INT32R(0, INT32_MAX));
 
 // solver options
@@ -73,7 +82,16 @@ BOOL_OPT opt_chronoreuse_en("chronoreusetrail", "enable reuse trail when chronol
 BOOL_OPT opt_model_en("model", "print model on stdout", false);
 BOOL_OPT opt_proof_en("proof", "generate proof in binary DRAT format", false);
 BOOL_OPT opt_priorbins_en("priorbins", "prioritize binaries in watch table", true);
+BOOL_OPT opt_recycle_sort_en("recyclesort", "relocate clauses in VSIDS activity order of their watches in stable mode", false);
+BOOL_OPT opt_tier_arenas_en("tierarenas", "keep originals, tier1/2 and tier3 learnts in separate clause arenas", true);
+BOOL_OPT opt_mmap_en("mmap", "map large clause arena, watch table and variable blocks with mmap", false);
+BOOL_OPT opt_hugepages_en("hugepages", "advise transparent huge pages for mapped blocks", true);
+BOOL_OPT opt_numa_en("mmapnuma", "prefer the NUMA node of the allocating thread for mapped blocks", false);
 INT_OPT opt_timeout("timeout", "set the timeout in seconds", 0, INT32R(0, INT32_MAX));
+INT_OPT opt_mem_limit("memlimit", "memory budget in MB, degrade simplification and reductions to stay within (0 = off)", 0, INT32R(0, INT32_MAX));
+INT_OPT opt_mmap_min("mmapmin", "minimum block size in KB to be mapped with mmap", 2048, INT32R(4, INT32_MAX));
+INT_OPT opt_mem_pressure("mempressure", "per mille of the memory budget above which the solver degrades", 900, INT32R(100, 1000));
+INT_OPT opt_timeout_ticks("timeoutticks", "search ticks between two timeout checks", 1 << 20, INT32R(1, INT32_MAX));
 INT_OPT opt_progress("progressrate", "progress rate to print search statistics", 15000, INT32R(1, INT32_MAX));
 INT_OPT opt_seed("seed", "seed value for random generation", 0, INT32R(0, INT32_MAX));
 INT_OPT opt_mdm_vsidspumps("mdmvsidspumps", "set the number of followup decision pumps using VSIDS activity", 1, INT32R(0, INT32_MAX));
@@ -86,13 +104,15 @@ INT_OPT opt_mdm_minc("mdmminc", "MDM conflicts limit increment in master mode",
 INT_OPT opt_map_min("mapmin", "minimum variables to map", 100, INT32R(0, INT32_MAX));
 INT_OPT opt_map_inc("mapinc", "mapping increment value based on conflicts", 2000, INT32R(0, INT32_MAX));
 INT_OPT opt_sigma_inc("sigmainc", "live sigma increment value based on conflicts", 2000, INT32R(1, INT32_MAX));
+INT_OPT opt_sigma_effort("sigmaeffort", "live sigma effort in per mille of search ticks since the last sigmification", 500, INT32R(1, INT32_MAX));
 INT_OPT opt_sigma_min("sigmamin", "minimum root variables shrunken to awaken SIGmA", 4000, INT32R(1, INT32_MAX));
 INT_OPT opt_chrono_min("chronomin", "minimum distance to trigger chronological backtracking", 100, INT32R(0, INT32_MAX));
 INT_OPT opt_subsume_inc("subsumeinc", "forward subsumption increment value based on conflicts", 10000, INT32R(100, INT32_MAX));
+INT_OPT opt_subsume_effort("subsumeeffort", "forward subsumption effort in per mille of search ticks since the last call", 200, INT32R(1, INT32_MAX));
 INT_OPT opt_subsume_min_occs("subsumeminoccurs", "minimum occurrences to subsume or strengthen", 30000, INT32R(10, INT32_MAX));
 INT_OPT opt_subsume_max_csize("subsumemaxcsize", "maximum subsuming clause size", 1000, INT32R(2, INT32_MAX));
-INT_OPT opt_subsume_max_checks("subsumemaxchecks", "maximum number of clauses to scan in subsume", 100000000, INT32R(100, INT32_MAX));
-INT_OPT opt_subsume_min_checks("subsumeminchecks", "minimum number of clauses to scan in subsume", 1000000, INT32R(100, INT32_MAX));
+INT_OPT opt_subsume_max_ticks("subsumemaxticks", "maximum ticks (cache lines read) of a subsume call", 200000000, INT32R(100, INT32_MAX));
+INT_OPT opt_subsume_min_ticks("subsumeminticks", "minimum ticks (cache lines read) of a subsume call", 2000000, INT32R(100, INT32_MAX));
 INT_OPT opt_reduce_inc("reduceinc", "increment value of clauses reduction based on conflicts", 300, INT32R(10, INT32_MAX));
 INT_OPT opt_lbd_tier1("lbdtier1", "lbd value of tier 1 learnts", 2, INT32R(1, INT32_MAX));
 INT_OPT opt_lbd_tier2("lbdtier2", "lbd value of tier 2 learnts", 6, INT32R(3, INT32_MAX));
@@ -108,6 +128,9 @@ INT_OPT opt_rephase_inc("rephaseinc", "rephasing increment value based on confli
 INT_OPT opt_powrestart_inc("powerrestartinc", "power restart increment value based on conflicts", 2, INT32R(0, INT32_MAX));
 INT_OPT opt_stabrestart_inc("stablerestartinc", "stable restart increment value based on conflicts", 1000, INT32R(1, INT32_MAX));
 INT_OPT opt_worker_count("workers", "number of worker threads for parallel algorithms", (int)std::thread::hardware_concurrency(), INT32R(1, INT32_MAX));
+INT_OPT opt_stats_period("statsperiod", "rewrite statistics files every n conflicts (0 = at exit only)", 0, INT32R(0, INT32_MAX));
+INT_OPT opt_telemetry_period("telemetryperiod", "seconds between two telemetry snapshots", 10, INT32R(1, INT32_MAX));
+INT_OPT opt_trace_size("tracesize", "trace events kept per thread (the latest ones survive)", 1 << 16, INT32R(16, INT32_MAX));
 INT_OPT opt_batch_max("batchmax", "the maximum number of jobs to be put together in a batch", 256, INT32R(1, INT32_MAX));
 DOUBLE_OPT opt_stabrestart_rate("stablerestartrate", "stable restart increase rate", 2.0, FP64R(1, 5));
 DOUBLE_OPT opt_lbd_rate("lbdrate", "slow rate in firing lbd restarts", 1.1, FP64R(1, 10));
@@ -117,11 +140,26 @@ DOUBLE_OPT opt_var_inc("varinc", "VSIDS increment value", 1.0, FP64R(1, 10));
 DOUBLE_OPT opt_var_decay("vardecay", "VSIDS decay value", 0.95, FP64R(0, 1));
 DOUBLE_OPT opt_garbage_perc("gcperc", "collect garbage if its percentage exceeds this value", 0.25, FP64R(0, 1));
 STRING_OPT opt_proof_out("prooffile", "output file to write binary proof", "proof.out");
+STRING_OPT opt_stats_json("statsjson", "output file to write statistics in JSON", "");
+STRING_OPT opt_stats_csv("statscsv", "output file to write statistics in CSV", "");
+STRING_OPT opt_trace("trace", "output file to write a timeline of stages and worker jobs in Chrome trace format", "");
+STRING_OPT opt_telemetry("telemetry", "output file to write progress telemetry in Prometheus text format", "");
 
 void OPTION::init() {
 	parse_only_en = opt_parseonly_en;
 	priorbins_en = opt_priorbins_en;
+	mmap_en = opt_mmap_en;
+	hugepages_en = opt_hugepages_en;
+	numa_en = opt_numa_en;
+	mmap_min = opt_mmap_min;
 	proof_path = opt_proof_out;
+	stats_json = *(arg_t)opt_stats_json ? (arg_t)opt_stats_json : NULL;
+	stats_csv = *(arg_t)opt_stats_csv ? (arg_t)opt_stats_csv : NULL;
+	stats_period = (stats_json || stats_csv) ? (int)opt_stats_period : 0;
+	telemetry_path = *(arg_t)opt_telemetry ? (arg_t)opt_telemetry : NULL;
+	telemetry_period = opt_telemetry_period;
+	trace_path = *(arg_t)opt_trace ? (arg_t)opt_trace : NULL;
+	trace_size = opt_trace_size;
 	proof_en = opt_proof_en;
 	prograte = opt_progress;
 	polarity = opt_polarity;
@@ -165,15 +203,20 @@ void OPTION::init() {
 	sigma_en = opt_sig_pre_en;
 	sigma_live_en = opt_sig_live_en;
 	sigma_inc = opt_sigma_inc;
+	sigma_effort = opt_sigma_effort;
 	sigma_min = opt_sigma_min;
 	subsume_en = opt_subsume_en;
 	subsume_inc = opt_subsume_inc;
+	subsume_effort = opt_subsume_effort;
 	subsume_min_occs = opt_subsume_min_occs;
-	subsume_min_checks = opt_subsume_min_checks;
-	subsume_max_checks = opt_subsume_max_checks;
+	subsume_min_ticks = opt_subsume_min_ticks;
+	subsume_max_ticks = opt_subsume_max_ticks;
 	subsume_max_csize = opt_subsume_max_csize;
 	seed = opt_seed;
 	timeout = opt_timeout;
+	timeout_ticks = opt_timeout_ticks;
+	mem_limit = opt_mem_limit;
+	mem_pressure = opt_mem_pressure;
 	lbd_tier1 = opt_lbd_tier1;
 	lbd_tier2 = opt_lbd_tier2;
 	lbd_fast = opt_lbd_fast;
@@ -184,6 +227,8 @@ void OPTION::init() {
 	learntsub_max = opt_learntsub_max;
 	target_phase_en = opt_targetphase_en;
 	gc_perc = opt_garbage_perc;
+	tier_arenas_en = opt_tier_arenas_en;
+	recycle_sort_en = opt_recycle_sort_en;
 	worker_count = opt_worker_count;
 	batch_max = opt_batch_max;
 	// initialize simplifier options
@@ -197,11 +242,17 @@ void OPTION::init() {
 		hbr_en = opt_hbr_en && opt_igr_en;
 		bce_en = opt_bce_en;
 		ere_en = opt_ere_en;
+		ere_hash = opt_ere_hash;
+		dce_en = opt_dce_en;
 		all_en = opt_all_en;
 		phases = opt_phases;
 		mu_pos = opt_mu_pos;
 		mu_neg = opt_mu_neg;
 		lcve_min = opt_lcve_min;
+		lcve_colors = opt_lcve_colors;
+		cost_sched = opt_cost_sched;
+		deterministic = opt_deterministic;
+		ve_split = opt_ve_split;
 		lits_min = opt_ve_phase_min;
 		shrink_rate = opt_cnf_free;
 		hse_limit = opt_hse_max_occurs;
@@ -210,11 +261,14 @@ void OPTION::init() {
 		xor_max_arity = opt_xor_max_arity;
 		hbr_max = opt_hbr_max;
 		rse_max = opt_rse_max;
+		igr_labels = opt_igr_labels;
+		igr_effort = opt_igr_effort;
+		igr_label_mem = opt_igr_label_mem;
 		igr_en = opt_igr_en;
 		ce_en = opt_ce_en;
 		ve_en = opt_ve_en || ve_plus_en;
 		hse_en = opt_hse_en || ve_plus_en;
-		if (all_en) igr_en = 1, fle_en = 1, hbr_en = 1, ce_en = 1, ve_en = 1, ve_plus_en = 1, hla_en = 1, bce_en = 1, ere_en = 1;
+		if (all_en) igr_en = 1, fle_en = 1, hbr_en = 1, ce_en = 1, ve_en = 1, ve_plus_en = 1, hla_en = 1, bce_en = 1, ere_en = 1, dce_en = 1;
 		if (!phases && (igr_en || ve_en || hse_en || bce_en)) phases = 1; // at least 1 phase needed
 		if (phases && !(igr_en || ve_en || hse_en || bce_en)) phases = 0;
 		if (phases > 1 && !ve_en) phases = 1;
@@ -32,11 +32,12 @@ namespace pFROST {
 		LIT_ST	polarity;
 		//------------------------------------------//
 		string	proof_path;
+		arg_t	stats_json, stats_csv, telemetry_path, trace_path;
 		//------------------------------------------//
 		int64	stabrestart_inc;
 		int64	learntsub_max;
 		//------------------------------------------//
-		uint32	sigma_min, sigma_inc;
+		uint32	sigma_min, sigma_inc, sigma_effort;
 		uint32	map_min, map_inc;
 		//------------------------------------------//
 		double	var_inc, var_decay;
@@ -46,7 +47,9 @@ namespace pFROST {
 		double	map_perc;
 		double	reduce_perc;
 		//------------------------------------------//
-		int		timeout;
+		int		timeout, timeout_ticks;
+		int		mem_limit, mem_pressure;
+		int		mmap_min;
 		int		seed;
 		int		prograte;
 		int		chrono_min;
@@ -58,9 +61,12 @@ namespace pFROST {
 		int		luby_inc, luby_max;
 		int		minimizebin_max, minimize_depth;
 		int		mdm_rounds,	mdm_freq, mdm_div, mdm_minc, mdm_sinc, mdm_vsids_pumps, mdm_vmfq_pumps;
-		int		subsume_inc, subsume_min_occs, subsume_min_checks, subsume_max_checks, subsume_max_csize;
+		int		subsume_inc, subsume_effort, subsume_min_occs, subsume_min_ticks, subsume_max_ticks, subsume_max_csize;
 		int		hbr_max, rse_max;
 		int		worker_count;
+		int		stats_period;
+		int		telemetry_period;
+		int		trace_size;
 		int		batch_max;
 		//------------------------------------------//
 		bool	model_en;
@@ -72,6 +78,8 @@ namespace pFROST {
 		bool	subsume_en;
 		bool	parse_only_en;
 		bool	priorbins_en;
+		bool	tier_arenas_en, recycle_sort_en;
+		bool	mmap_en, hugepages_en, numa_en;
 		bool	reusetrail_en;
 		bool	chronoreuse_en;
 		bool	bumpreason_en;
@@ -83,7 +91,8 @@ namespace pFROST {
 		//==========================================//
 		bool	hse_en;
 		bool	bce_en;
-		bool	ere_en;
+		bool	ere_en, ere_hash;
+		bool	dce_en;
 		bool	igr_en;
 		bool	fle_en;
 		bool	hbr_en;
@@ -94,14 +103,18 @@ namespace pFROST {
 		bool	aggr_cnf_sort;
 		bool	profile_simp;
 		bool	ve_en, ve_plus_en;
+		bool	cost_sched;
+		bool	deterministic;
 		bool	sigma_en, sigma_live_en;
 		//------------------------------------------//
 		int		phases;
 		int		shrink_rate;
 		int		xor_max_arity;
 		int		hse_limit, bce_limit, ere_limit;
+		int		igr_labels, igr_effort, igr_label_mem;
 		//------------------------------------------//
-		uint32	lcve_min;
+		uint32	lcve_min, lcve_colors;
+		uint32	ve_split;
 		uint32	lits_min;
 		uint32	mu_pos, mu_neg;
 		//------------------------------------------//
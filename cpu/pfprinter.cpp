@@ -151,13 +151,15 @@ void ParaFROST::printOL(const uint32& lit)
 void ParaFROST::printWL(const uint32& lit, const bool& bin)
 {
 	CHECKLIT(lit);
-	const WL& ws = wt[lit];
-	if (ws.size()) PFLOG1("  list(%d):", -l2i(lit));
-	for (int i = 0; i < ws.size(); i++) {
-		if (!ws[i].binary() && bin) continue;
+	const WL bs = wtBin[lit], ws = wt[lit];
+	if (bs.size() || (ws.size() && !bin)) PFLOG1("  list(%d):", -l2i(lit));
+	for (int i = 0; i < bs.size(); i++)
+		PFLCLAUSE(1, cm[bs[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
+			CLOGGING, (size_t)bs[i].ref, 2, l2i(bs[i].imp), CNORMAL);
+	if (bin) return;
+	for (int i = 0; i < ws.size(); i++)
 		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
-			CLOGGING, ws[i].ref, ws[i].size, l2i(ws[i].imp), CNORMAL);
-	}
+			CLOGGING, (size_t)ws[i].ref, cm[ws[i].ref].size(), l2i(ws[i].imp), CNORMAL);
 }
 
 void ParaFROST::printWatched(const uint32& v)
@@ -207,7 +209,7 @@ void ParaFROST::printSource()
 		uint32 v = ABS(trail[i]);
 		C_REF r = sp->source[v];
 		if (REASON(r))
-			PFLCLAUSE(1, cm[r], " Source(v:%d, r:%zd)->", v, r);
+			PFLCLAUSE(1, cm[r], " Source(v:%d, r:%zd)->", v, (size_t)r);
 	}
 }
 
@@ -20,8 +20,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __RALLOC_
 
 #include "pfdtypes.h"
+#include "pfmemory.h"
 #include <cstdlib>
 #include <cstring>
+#ifdef __linux__ 
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace pFROST {
 
@@ -44,6 +50,82 @@ namespace pFROST {
 		mem = _mem;
 	}
 
+	// Page-mapped backend for large blocks. Blocks of at least 'minBytes'
+	// in an enabled category are mapped straight from the kernel, grown
+	// with 'mremap' which moves page tables instead of copying data,
+	// advised for transparent huge pages and optionally preferred on the
+	// NUMA node of the allocating thread. Must be set up before any block
+	// of the enabled categories is allocated
+	struct PAGES {
+		size_t	minBytes;
+		uint32	cats;
+		bool	huge, numa;
+
+		PAGES() : minBytes(0), cats(0), huge(false), numa(false) {}
+		inline bool use(const Byte& cat, const size_t& bytes) const {
+			return (cats & (1U << cat)) && bytes >= minBytes;
+		}
+	};
+
+	inline PAGES pages;
+
+#ifdef __linux__ 
+	inline void pfadvise(void* mem, const size_t& bytes) {
+		if (pages.huge) madvise(mem, bytes, MADV_HUGEPAGE);
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+		if (pages.numa) {
+			unsigned cpu = 0, node = 0;
+			if (!syscall(SYS_getcpu, &cpu, &node, NULL) && node < 64) {
+				const unsigned long mask = 1UL << node;
+				syscall(SYS_mbind, mem, bytes, 1 /* MPOL_PREFERRED */, &mask, 64UL, 0U);
+			}
+		}
+#endif
+	}
+#endif
+
+	// (re)allocate 'mem' from 'oldBytes' to 'bytes' with the backend chosen
+	// by 'cat'; 'paged' tells which backend holds 'mem' and is updated
+	template <class T>
+	void pfrealloc(T*& mem, bool& paged, const size_t& oldBytes, const size_t& bytes, const Byte& cat) {
+		const bool want = pages.use(cat, bytes);
+		if (!want && !paged) { pfalloc(mem, bytes); return; }
+#ifdef __linux__ 
+		void* _mem = MAP_FAILED;
+		if (want && paged) _mem = mremap(mem, oldBytes, bytes, MREMAP_MAYMOVE);
+		else if (want) _mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		else {
+			// back to the heap
+			T* heap = NULL;
+			pfalloc(heap, bytes);
+			std::memcpy((void*)heap, mem, bytes < oldBytes ? bytes : oldBytes);
+			munmap(mem, oldBytes);
+			mem = heap, paged = false;
+			return;
+		}
+		if (_mem == MAP_FAILED) throw MEMOUTEXCEPTION();
+		pfadvise(_mem, bytes);
+		if (!paged && mem != NULL) {
+			std::memcpy(_mem, mem, bytes < oldBytes ? bytes : oldBytes);
+			std::free(mem);
+		}
+		mem = (T*)_mem, paged = true;
+#else
+		pfalloc(mem, bytes);
+#endif
+	}
+
+	template <class T>
+	void pffree(T*& mem, bool& paged, const size_t& bytes) {
+		if (mem == NULL) return;
+#ifdef __linux__ 
+		if (paged) munmap(mem, bytes);
+		else
+#endif
+		std::free(mem);
+		mem = NULL, paged = false;
+	}
+
 }
 
 #endif
\ No newline at end of file
@@ -17,43 +17,35 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 **********************************************************************************/
 
 #include "pfsolve.h"
+#include "pfsort.h"
 using namespace pFROST;
 
+struct RECYCLE_CMP {
+	const double* acts;
+	RECYCLE_CMP(const double* _acts) : acts(_acts) {}
+	bool operator () (const uint32& a, const uint32& b) const {
+		return acts[a] > acts[b];
+	}
+};
+
 inline void ParaFROST::moveClause(C_REF& r, CMM& newBlock) {
-	assert(r < cm.size());
+	assert(cm.check(r));
 	CLAUSE& c = cm[r];
 	assert(!c.deleted());
 	if (c.moved()) { r = c.ref(); return; }
-	r = newBlock.alloc(c);
+	if (!newBlock.opened(CMM::region(r))) return;
+	// a promoted clause goes to its tier's region; if that region is
+	// not collected, the clause is appended to it in place
+	const Byte to = tierOf(c);
+	r = newBlock.opened(to) ? newBlock.alloc(c, to) : cm.alloc(c, to);
 	c.set_ref(r);
 }
 
-inline void	ParaFROST::recycleWL(WL& ws, CMM& new_cm) {
+inline void	ParaFROST::recycleWL(const WL& ws, CMM& new_cm) {
 	for (WATCH* w = ws; w != ws.end(); w++)
 		moveClause(w->ref, new_cm);
 }
 
-inline void	ParaFROST::recycleWL(const uint32& lit) {
-	WL& ws = wt[lit], saved;
-	if (ws.empty()) { ws.clear(true); return; }
-	WATCH* i, *j = ws, *end = ws.end();
-	for (i = j; i != end; i++) {
-		WATCH w = *i;
-		assert(w.ref != NOREF);
-		const CLAUSE& c = cm[w.ref];
-		if (c.deleted()) continue;
-		w.size = c.size();
-		int litpos = (c[0] == FLIP(lit));
-		assert(c[!litpos] == FLIP(lit));
-		w.imp = c[litpos];
-		if (w.binary()) *j++ = w;
-		else saved.push(w);
-	}
-	ws.resize(int(j - ws));
-	for (WATCH* s = saved; s != saved.end(); s++) ws.push(*s);
-	if (ws.empty()) ws.clear(true);
-	saved.clear(true);
-}
 
 void ParaFROST::protectReasons() {
 	for (uint32 i = 0; i < trail.size(); i++) {
@@ -82,19 +74,48 @@ void ParaFROST::unprotectReasons() {
 }
 
 void ParaFROST::recycleWT() {
-	for (uint32 v = 1; v <= inf.maxVar; v++) {
-		uint32 p = V2L(v), n = NEG(p);
-		recycleWL(p), recycleWL(n);
-	}
+	// drop watches of deleted clauses and refresh the others
+	// while the slabs are compacted
+	auto refresh = [this](const uint32& lit, WATCH& w) {
+		assert(w.ref != NOREF);
+		const CLAUSE& c = cm[w.ref];
+		if (c.deleted()) return false;
+		w.resize(c.size());
+		int litpos = (c[0] == FLIP(lit));
+		assert(c[!litpos] == FLIP(lit));
+		w.imp = c[litpos];
+		return true;
+	};
+	// clauses shrunken to binaries move over to the binary table
+	wt.compact([&](const uint32& lit, WATCH& w) {
+		if (!refresh(lit, w)) return false;
+		if (w.binary()) { wtBin[lit].push(w); return false; }
+		return true;
+	});
+	wtBin.compact(refresh);
 }
 
 void ParaFROST::recycle(CMM& new_cm)
 {
 	recycleWT();
-	for (uint32 q = vmfq.last(); q; q = vmfq.previous(q)) {
-		uint32 lit = makeAssign(q), flit = FLIP(lit);
-		recycleWL(wt[lit], new_cm);
-		recycleWL(wt[flit], new_cm);
+	// clauses watched by the variables the search picks next are placed
+	// first: most active ones in stable mode, last bumped ones otherwise
+	if (vsidsEnabled() && opts.recycle_sort_en) {
+		uVec1D vars(inf.maxVar);
+		for (uint32 v = 1; v <= inf.maxVar; v++) vars[v - 1] = v;
+		Sort(vars, RECYCLE_CMP(activity));
+		for (uint32* v = vars; v != vars.end(); v++) {
+			uint32 lit = makeAssign(*v), flit = FLIP(lit);
+			recycleWL(wtBin[lit], new_cm), recycleWL(wt[lit], new_cm);
+			recycleWL(wtBin[flit], new_cm), recycleWL(wt[flit], new_cm);
+		}
+	}
+	else {
+		for (uint32 q = vmfq.last(); q; q = vmfq.previous(q)) {
+			uint32 lit = makeAssign(q), flit = FLIP(lit);
+			recycleWL(wtBin[lit], new_cm), recycleWL(wt[lit], new_cm);
+			recycleWL(wtBin[flit], new_cm), recycleWL(wt[flit], new_cm);
+		}
 	}
 	uint32 count = 0;
 	for (uint32* t = trail; t != trail.end(); t++) {
@@ -102,7 +123,7 @@ void ParaFROST::recycle(CMM& new_cm)
 		C_REF& r = sp->source[v];
 		if (r == NOREF) continue;
 		if (!sp->level[v]) { r = NOREF; continue; }
-		assert(r < cm.size());
+		assert(cm.check(r));
 		if (cm[r].deleted()) { r = NOREF; continue; }
 		assert(cm[r].reason());
 		moveClause(r, new_cm);
@@ -121,10 +142,28 @@ void ParaFROST::recycle() {
 	shrink();
 	if (canCollect()) {
 		PFLOGN2(2, " Recycling garbage..");
-		CMM new_cm(cm.size() - cm.garbage());
+		// only wasteful regions are collected; under memory pressure all
+		// are, leaving some headroom so the next learnt clause does not
+		// double a region right away
+		const bool squeeze = memPressure();
+		const C_REF before = cm.size();
+		Byte collected = 0;
+		for (Byte g = 0; g < CM_REGIONS; g++)
+			if (squeeze || cm.wasteful(g, opts.gc_perc)) collected |= Byte(1 << g);
+		// promoted clauses leave their region for the one of their tier
+		CMM new_cm;
+		C_REF caps[CM_REGIONS];
+		for (Byte g = 0; g < CM_REGIONS; g++) {
+			if (!(collected & (1 << g))) continue;
+			const C_REF live = cm.live(g, collected);
+			new_cm.open(g, squeeze ? live + (live >> 3) : live);
+			caps[g] = new_cm.capacity(g);
+		}
 		recycle(new_cm);
-		PFLGCMEM(2, cm, new_cm);
+		for (Byte g = 0; g < CM_REGIONS; g++)
+			assert(!new_cm.opened(g) || new_cm.capacity(g) == caps[g]);
 		new_cm.migrate(cm);
+		PFPRINT(2, 5, "(%.2f KB saved) ", (double(before) - double(cm.size())) * cm.bucket() / KBYTE);
 		PFLDONE(2, 5);
 	}
 	else recycleWT(), filter(learnts);
@@ -174,14 +213,7 @@ void ParaFROST::shrink(BCNF& cnf) {
 
 void ParaFROST::filter(BCNF& cnf) {
 	if (cnf.empty()) return;
-	C_REF* i, * j, * end = cnf.end();
-	for (i = cnf, j = i; i != end; i++) {
-		C_REF r = *i;
-		if (cm[r].deleted()) continue;
-		*j++ = r;
-	}
-	assert(j >= cnf);
-	cnf.resize(uint32(j - cnf));
+	workerPool.compact(cnf, [this](const C_REF r) { return !cm[r].deleted(); });
 }
 
 void ParaFROST::filter(BCNF& cnf, BCNF& dest, const CL_ST& t) {
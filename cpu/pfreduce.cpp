@@ -64,17 +64,28 @@ bool ParaFROST::BCPChronoRoot() {
 
 void ParaFROST::reduce()
 {
+	PFTRACE("reduce");
 	assert(sp->propagated == trail.size());
 	assert(conflict == NOREF);
 	assert(cnfstate == UNSOLVED);
 	assert(learnts.size());
-	stats.reduces++;
 	if (!BCPChronoRoot()) return;
+	const bool squeeze = memPressure();
+	if (squeeze) {
+		PFLOG2(1, " Memory limit: reducing learnts and shrinking the clause arena (%.2f MB tracked)", (double)memAccount.total() / MBYTE);
+		stats.memsqueezes++;
+		lrn.mem_reduce_conf_max = nConflicts + opts.reduce_inc;
+	}
 	bool shrunken = shrink();
 	protectReasons();
-	reduceLearnts();
+	reduceLearnts(false, squeeze);
 	recycle();
 	unprotectReasons();
+	if (nConflicts < lrn.reduce_conf_max) { // forced by memory pressure, counted as a squeeze only
+		if (shrunken && canMap()) map();
+		return;
+	}
+	stats.reduces++;
 	double current_inc = (double)opts.reduce_inc * (stats.reduces + 1);
 	reduceWeight(current_inc);
 	lrn.lastreduce = nConflicts;
@@ -83,7 +94,7 @@ void ParaFROST::reduce()
 	if (shrunken && canMap()) map(); // "recycle" must be called beforehand
 }
 
-void ParaFROST::reduceLearnts(const bool& sizeonly)
+void ParaFROST::reduceLearnts(const bool& sizeonly, const bool& squeeze)
 {
 	assert(reduced.empty());
 	reduced.reserve(learnts.size());
@@ -99,7 +110,9 @@ void ParaFROST::reduceLearnts(const bool& sizeonly)
 		reduced.push(*r);
 	}
 	if (reduced.size()) {
-		uint32 pivot = (uint32)std::floor(opts.reduce_perc * reduced.size());
+		// under memory pressure, half of the kept share goes as well
+		const double perc = squeeze ? (1 + opts.reduce_perc) / 2 : opts.reduce_perc;
+		uint32 pivot = (uint32)std::floor(perc * reduced.size());
 		PFLOGN2(2, " Reducing learnt database up to (%d clauses)..", pivot);
 		if (sizeonly) std::stable_sort(reduced.data(), reduced.end(), LEARNT_SZ_CMP(cm));
 		else std::stable_sort(reduced.data(), reduced.end(), LEARNT_CMP(cm));
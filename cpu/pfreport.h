@@ -0,0 +1,148 @@
+/***********************************************************************[pfreport.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfdtypes.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace pFROST {
+
+	// write 'data' to a temporary file and rename it to 'path' so
+	// readers never see a half written file
+	inline bool replaceFile(const std::string& path, const std::string& data) {
+		const std::string tmp = path + ".tmp";
+		std::ofstream out(tmp, std::ios::out | std::ios::trunc | std::ios::binary);
+		if (!out.is_open()) return false;
+		out.write(data.c_str(), data.size());
+		out.close();
+		if (out.fail()) return false;
+		return !std::rename(tmp.c_str(), path.c_str());
+	}
+
+	// SIGmA reductions of one stage as shown by 'logReductions'
+	struct REDUCTION {
+		std::string stage;
+		int sigmification, phase;
+		int64 varsRemoved, clsRemoved, litsRemoved;
+		int64 vars, clauses, literals;
+	};
+
+	// Machine-readable statistics. Values are collected in groups and
+	// rendered as JSON or CSV into memory, each file is then replaced
+	// in one go
+	class REPORT {
+		struct ENTRY {
+			std::string group, key, value;
+			bool quoted;
+		};
+		std::vector<ENTRY>		_entries;
+		std::vector<REDUCTION>	_reductions;
+
+		inline static void		escape		(std::string& out, const std::string& in) {
+			for (const char ch : in) {
+				if (ch == '"' || ch == '\\') out += '\\';
+				if ((unsigned char)ch >= 0x20) out += ch;
+			}
+		}
+		inline static void		quote		(std::string& out, const std::string& in) {
+			out += '"';
+			for (const char ch : in) {
+				if (ch == '"') out += '"';
+				if ((unsigned char)ch >= 0x20) out += ch;
+			}
+			out += '"';
+		}
+
+	public:
+		inline void				clear		() { _entries.clear(); }
+		inline void				add			(const char* group, const char* key, const int64& val) {
+			_entries.push_back({ group, key, std::to_string(val), false });
+		}
+		inline void				add			(const char* group, const char* key, const double& val) {
+			char buf[32];
+			snprintf(buf, sizeof(buf), "%.6f", std::isfinite(val) ? val : 0.0);
+			_entries.push_back({ group, key, buf, false });
+		}
+		inline void				add			(const char* group, const char* key, const char* val) {
+			_entries.push_back({ group, key, val, true });
+		}
+		inline void				reduction	(const REDUCTION& r) { _reductions.push_back(r); }
+		inline bool				writeJSON	(const std::string& path) const {
+			std::string out = "{";
+			const std::string* group = NULL;
+			for (const ENTRY& e : _entries) {
+				if (group == NULL || *group != e.group) {
+					if (group != NULL) out += "\n\t},";
+					out += "\n\t\"", escape(out, e.group), out += "\": {";
+					group = &e.group;
+				}
+				else out += ",";
+				out += "\n\t\t\"", escape(out, e.key), out += "\": ";
+				if (e.quoted) out += "\"", escape(out, e.value), out += "\"";
+				else out += e.value;
+			}
+			if (group != NULL) out += "\n\t},";
+			out += "\n\t\"reductions\": [";
+			for (size_t i = 0; i < _reductions.size(); i++) {
+				const REDUCTION& r = _reductions[i];
+				out += i ? ",\n\t\t{ " : "\n\t\t{ ";
+				out += "\"stage\": \"", escape(out, r.stage), out += "\"";
+				out += ", \"sigmification\": " + std::to_string(r.sigmification);
+				out += ", \"phase\": " + std::to_string(r.phase);
+				out += ", \"vars_removed\": " + std::to_string(r.varsRemoved);
+				out += ", \"clauses_removed\": " + std::to_string(r.clsRemoved);
+				out += ", \"literals_removed\": " + std::to_string(r.litsRemoved);
+				out += ", \"vars\": " + std::to_string(r.vars);
+				out += ", \"clauses\": " + std::to_string(r.clauses);
+				out += ", \"literals\": " + std::to_string(r.literals) + " }";
+			}
+			out += _reductions.empty() ? "]\n}\n" : "\n\t]\n}\n";
+			return replaceFile(path, out);
+		}
+		// one 'name,value' row per entry, reductions are numbered
+		inline bool				writeCSV	(const std::string& path) const {
+			std::string out = "name,value\n";
+			for (const ENTRY& e : _entries) {
+				out += e.group + "." + e.key + ",";
+				if (e.quoted) quote(out, e.value);
+				else out += e.value;
+				out += "\n";
+			}
+			for (size_t i = 0; i < _reductions.size(); i++) {
+				const REDUCTION& r = _reductions[i];
+				const std::string p = "reductions." + std::to_string(i) + ".";
+				out += p + "stage,", quote(out, r.stage), out += "\n";
+				out += p + "sigmification," + std::to_string(r.sigmification) + "\n";
+				out += p + "phase," + std::to_string(r.phase) + "\n";
+				out += p + "vars_removed," + std::to_string(r.varsRemoved) + "\n";
+				out += p + "clauses_removed," + std::to_string(r.clsRemoved) + "\n";
+				out += p + "literals_removed," + std::to_string(r.litsRemoved) + "\n";
+				out += p + "vars," + std::to_string(r.vars) + "\n";
+				out += p + "clauses," + std::to_string(r.clauses) + "\n";
+				out += p + "literals," + std::to_string(r.literals) + "\n";
+			}
+			return replaceFile(path, out);
+		}
+	};
+
+}
@@ -28,7 +28,8 @@ void ParaFROST::newClause(SCLAUSE& s)
 	assert(sz > 1);
 	// NOTE: 's' should be used with 'sp' before any mapping is done
 	if (stats.sigmifications > 1 && s.added()) markSubsume(s);
-	C_REF r = cm.alloc(sz);
+	const bool keep = !s.learnt() || sz == 2 || s.lbd() <= opts.lbd_tier1;
+	C_REF r = cm.alloc(sz, tierOf(s.status(), s.lbd(), keep));
 	CLAUSE& new_c = cm[r];
 	if (mapped) vmap.mapClause(new_c, s);
 	else new_c.copyLitsFrom(s);
@@ -42,8 +43,7 @@ void ParaFROST::newClause(SCLAUSE& s)
 		assert(s.usage() <= USAGET2);
 		assert(!s.added());
 		int lbd = s.lbd();
-		if (sz > 2 && lbd > opts.lbd_tier1) 
-			new_c.set_keep(0);
+		if (!keep) new_c.set_keep(0);
 		new_c.set_lbd(lbd);
 		new_c.set_usage(s.usage());
 		learnts.push(r);
@@ -74,6 +74,7 @@ void ParaFROST::newResolvent(S_REF s)
 		s->set_status(ORIGINAL);
 		s->markAdded();
 		s->calcSig();
+		s->set_id(nextId++);
 		scnf.push(s);
 	}
 	if (opts.proof_en) {
@@ -93,6 +94,7 @@ void ParaFROST::newBinary(S_REF s)
 	s->set_status(LEARNT);
 	s->markAdded();
 	s->calcSig();
+	s->set_id(nextId++);
 	scnf.push(s);
 	if (opts.proof_en) {
 		wrProof('a');
@@ -108,6 +110,7 @@ void ParaFROST::newSClause(S_REF s)
 	s->calcSig();
 	rSort(s->data(), s->size());
 	assert(s->isSorted());
+	s->set_id(nextId++);
 	scnf[inf.nClauses++] = s;
 	inf.nLiterals += s->size();
 }
\ No newline at end of file
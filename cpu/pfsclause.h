@@ -34,8 +34,16 @@ namespace pFROST {
 		uint64 _sig;
 		int _sz, _lbd;
 		std::atomic<CL_ST> _st, _f;
+		uint32 _id;
+		// accounted bytes follow the logical size, so literals cut off
+		// by 'shrink' count as released
+		inline void		account		(const int& lits) { memAccount.account(MEM_SCNF, int64(lits) * int64(sizeof(uint32))); }
+		inline void		allocLits	() {
+			_lits = new uint32[_sz];
+			memAccount.account(MEM_SCNF, int64(sizeof(SCLAUSE))), account(_sz);
+		}
 	public:
-		SCLAUSE		() { _lits = NULL, _sz = 0, _sig = 0, _st = 0, _f = 0; }
+		SCLAUSE		() { _lits = NULL, _sz = 0, _sig = 0, _st = 0, _f = 0, _id = 0; }
 		~SCLAUSE	() { clear(true); }
 		SCLAUSE		(const CLAUSE& src) {
 			_sz = src.size(), _st = src.status();
@@ -46,8 +54,8 @@ namespace pFROST {
 				assert(usage() == src.usage());
 			}
 			else { _lbd = 0, _f = 0; }
-			_lits = NULL, _sig = 0;
-			_lits = new uint32[_sz];
+			_sig = 0, _id = 0;
+			allocLits();
 			copyLitsFrom(src);
 			assert(!molten());
 			assert(!added());
@@ -55,8 +63,8 @@ namespace pFROST {
 		}
 		SCLAUSE		(const Lits_t& src) {
 			_sz = src.size();
-			_lits = NULL, _sig = 0, _st = 0, _f = 0;
-			_lits = new uint32[_sz];
+			_sig = 0, _st = 0, _f = 0, _id = 0;
+			allocLits();
 			copyLitsFrom(src);
 			assert(!_f);
 		}
@@ -66,7 +74,8 @@ namespace pFROST {
 			_sig = src.sig();
 			_st = src.status();
 			_f = (src.usage() << USAGE_OFF);
-			_lits = new uint32[_sz];
+			_id = src.id();
+			allocLits();
 			copyLitsFrom(src);
 		}
 		template <class SRC>
@@ -79,10 +88,11 @@ namespace pFROST {
 		}
 		inline void		set_sig		(const uint64& sig) { _sig = sig; }
 		inline void		set_lbd		(const int& lbd) { _lbd = lbd; }
+		inline void		set_id		(const uint32& id) { _id = id; }
 		inline void		set_status	(const CL_ST& status) { _st = status; }
 		inline void		set_usage	(const CL_ST& usage) { assert(usage <= USAGE_MAX); _f = (_f & USAGE_RES) | (usage << USAGE_OFF); }
-		inline void		shrink		(const int& n) { _sz -= n; }
-		inline void		resize		(const int& newSz) { _sz = newSz; }
+		inline void		shrink		(const int& n) { _sz -= n, account(-n); }
+		inline void		resize		(const int& newSz) { account(newSz - _sz), _sz = newSz; }
 		inline uint32	lit			(const int& i) { assert(i < _sz); return _lits[i]; }
 		inline uint32&	operator [] (const int& i) { assert(i < _sz); return _lits[i]; }
 		inline uint32	operator [] (const int& i) const { assert(i < _sz); return _lits[i]; }
@@ -90,7 +100,7 @@ namespace pFROST {
 		inline uint32*	data		() { return _lits; }
 		inline uint32*	end			() { return _lits + _sz; }
 		inline uint32	back		() { return _lits[_sz - 1]; }
-		inline void		pop			() { _sz--; }
+		inline void		pop			() { _sz--, account(-1); }
 		inline void		lock		() const { _m.lock(); }
 		inline bool		tryLock		() const { return _m.try_lock(); }
 		inline void		unlock		() const { _m.unlock(); }
@@ -106,6 +116,7 @@ namespace pFROST {
 		inline bool		deleted		() const { return _st & DELETED; }
 		inline CL_ST	status		() const { return _st; }
 		inline int		lbd			() const { return _lbd; }
+		inline uint32	id			() const { return _id; }
 		inline int		size		() const { return _sz; }
 		inline uint64	sig			() const { return _sig; }
 		inline int		hasZero		() const {
@@ -146,7 +157,8 @@ namespace pFROST {
 			}
 		}
 		inline void		clear		(bool _free = false) {
-			if (_free && _lits != NULL) { delete[] _lits; _lits = NULL; }
+			if (_lits != NULL) account(-_sz);
+			if (_free && _lits != NULL) { delete[] _lits; _lits = NULL; memAccount.account(MEM_SCNF, -int64(sizeof(SCLAUSE))); }
 			_sz = 0; _st = 0;
 		}
 		inline void		print		() const {
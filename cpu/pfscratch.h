@@ -0,0 +1,54 @@
+/***********************************************************************[pfscratch.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfsolvertypes.h"
+#include <vector>
+
+namespace pFROST {
+
+	// Temporaries of one worker; buffers are cleared by their users
+	// at the start of a job but never freed, so they keep their capacity.
+	// Counters are summed by the caller after the join; slots are line
+	// aligned so that workers bumping them do not share a cache line
+	struct alignas(CACHELINE) SCRATCH {
+		Lits_t	lits;
+		uVec1D	nodes, merged;
+		OL		cands, subsumed, mergedOL;
+		int64	hits, misses;
+		SCRATCH() : hits(0), misses(0) { lits.reserve(INIT_CAP); }
+	};
+
+	// Scratch slots of all workers, where slot 0 belongs to the main
+	// thread and slot 'i + 1' to worker 'i'
+	class SCRATCHES {
+		std::vector<SCRATCH> _slots;
+
+	public:
+		inline void		resize		(const uint32& threads) { if (_slots.size() <= threads) _slots.resize(threads + 1); }
+		inline void		clear		() { _slots.clear(); _slots.shrink_to_fit(); }
+		inline SCRATCH*	begin		() { return _slots.data(); }
+		inline SCRATCH*	end			() { return _slots.data() + _slots.size(); }
+		inline SCRATCH&	operator[]	(const int& tid) {
+			assert(tid + 1 >= 0 && size_t(tid + 1) < _slots.size());
+			return _slots[tid + 1];
+		}
+	};
+
+}
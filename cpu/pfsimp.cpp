@@ -24,6 +24,7 @@ using namespace SIGmA;
 
 void ParaFROST::createOT(const bool& rst)
 {
+	PFTRACE("createOT");
 	if (opts.profile_simp) timer.pstart();
 
 	// reset ot
@@ -52,25 +53,22 @@ void ParaFROST::createOT(const bool& rst)
 	});
 
 	workerPool.join();
+	if (opts.deterministic) orderOT();
 	if (opts.profile_simp) timer.pstop(), timer.cot += timer.pcpuTime();
 }
 
 void ParaFROST::reduceOL(OL& ol)
 {
 	if (ol.empty()) return;
-	int n = 0;
-	for (int i = 0; i < ol.size(); i++) {
-		if (ol[i]->deleted()) continue;
-		ol[n++] = ol[i];
-	}
-	ol.resize(n);
+	workerPool.compact(ol, [](const S_REF c) { return !c->deleted(); });
 }
 
 void ParaFROST::reduceOT()
 {
+	PFTRACE("reduceOT");
 	if (opts.profile_simp) timer.pstart();
 
-	workerPool.doWorkForEach((uint32)1, inf.maxVar, [&](uint32 v) {
+	workerPool.doWorkForEach((uint32)1, inf.maxVar + 1, [&](uint32 v) {
 		uint32 p = V2L(v), n = NEG(p);
 		reduceOL(ot[p]);
 		reduceOL(ot[n]);
@@ -82,6 +80,7 @@ void ParaFROST::reduceOT()
 
 void ParaFROST::sortOT(const bool& partial)
 {
+	PFTRACE("sortOT");
 	if (opts.profile_simp) timer.pstart();
 
 	if (!partial && opts.ce_en) {
@@ -109,6 +108,19 @@ void ParaFROST::sortOT(const bool& partial)
 	if (opts.profile_simp) timer.pstop(), timer.sot += timer.pcpuTime();
 }
 
+// restore the creation order of clauses in all lists after parallel insertion
+void ParaFROST::orderOT()
+{
+	PFTRACE("orderOT");
+	workerPool.doWorkForEach((uint32)0, inf.maxVar, [this](uint32 i) {
+		uint32 p = V2L(i + 1), n = NEG(p);
+		OL& poss = ot[p], & negs = ot[n];
+		std::sort(poss.data(), poss.data() + poss.size(), CNF_CMP_ID());
+		std::sort(negs.data(), negs.data() + negs.size(), CNF_CMP_ID());
+	});
+	workerPool.join();
+}
+
 void ParaFROST::extract(const BCNF& cnf)
 {
 	for (uint32 i = 0; i < cnf.size(); i++) {
@@ -120,6 +132,7 @@ void ParaFROST::extract(const BCNF& cnf)
 
 void ParaFROST::awaken(const bool& strict)
 {
+	PFTRACE("awaken");
 	assert(conflict == NOREF);
 	assert(cnfstate == UNSOLVED);
 	assert(sp->propagated == trail.size());
@@ -127,22 +140,44 @@ void ParaFROST::awaken(const bool& strict)
 	if (stats.sigmifications && strict) reduceTop(strict);
 	if (orgs.empty()) { sigState = AWAKEN_FAIL; return; }
 	// alloc simplifier memory 
-	PFLOGN2(2, " Allocating memory..");
 	size_t numCls = maxClauses(), numLits = maxLiterals();
 	size_t ot_cap = inf.nDualVars * sizeof(OL) + numLits * sizeof(S_REF);
-	size_t ig_cap = inf.nDualVars * sizeof(IG);
+	size_t ig_cap = inf.nDualVars * IG::nodeBytes();
 	size_t scnf_cap = numCls * sizeof(S_REF) + numLits * sizeof(uint32);
+	if (opts.mem_limit && !fitsMem(ot_cap + ig_cap + scnf_cap)) {
+		// degrade before giving up: fewer learnts first, then no IGR
+		stats.memsqueezes++;
+		if (stats.sigmifications && learnts.size()) {
+			PFLOG2(1, " Memory limit: reducing learnts before extracting them to SIGmA");
+			reduceTop(false);
+			numCls = maxClauses(), numLits = maxLiterals();
+			ot_cap = inf.nDualVars * sizeof(OL) + numLits * sizeof(S_REF);
+			scnf_cap = numCls * sizeof(S_REF) + numLits * sizeof(uint32);
+		}
+		if (opts.igr_en && !fitsMem(ot_cap + ig_cap + scnf_cap)) {
+			PFLOG2(1, " Memory limit: skipping IGR in this sigmification");
+			skipIGR = true, ig_cap = 0;
+		}
+		if (!fitsMem(ot_cap + ig_cap + scnf_cap)) {
+			PFLOG2(1, " Memory limit: skipping SIGmA (%.2f MB needed)", double(ot_cap + ig_cap + scnf_cap) / MBYTE);
+			sigState = SALLOC_FAIL;
+			return;
+		}
+	}
+	PFLOGN2(2, " Allocating memory..");
 	if (!checkMem("ot", ot_cap) || !checkMem("ig", ig_cap) || !checkMem("scnf", scnf_cap))
 	{
 		sigState = SALLOC_FAIL;
 		return;
 	}
-	ot.resize(inf.nDualVars), ig.resize(inf.nDualVars), scnf.resize(numCls);
+	ot.resize(inf.nDualVars), scnf.resize(numCls);
+	if (!skipIGR) ig.resize(inf.nDualVars, workerPool.count());
+	scratches.resize(workerPool.count());
 	PFLENDING(2, 5, "(%.1f MB used)", double(ot_cap + scnf_cap) / MBYTE);
 	// append clauses to scnf
 	PFLOGN2(2, " Extracting clauses to simplifying CNF..");
 	printStats(1, '-', CGREEN0), inf.nClauses = inf.nLiterals = 0;
-	wt.clear(true);
+	wt.clear(true), wtBin.clear(true);
 	extract(orgs), orgs.clear(true);
 	extract(learnts), learnts.clear(true);
 	// resize cnf & clean old database
@@ -155,10 +190,17 @@ void ParaFROST::awaken(const bool& strict)
 
 void ParaFROST::sigmify()
 {
+	PFTRACE("sigmify");
 	/********************************/
 	/*		Getting ready...        */
 	/********************************/
 	if (!opts.phases && !(opts.all_en || opts.ere_en)) return;
+	// live sigmification may spend a fraction of the search ticks
+	// since the last call, preprocessing (no search yet) is unlimited
+	const int64 searchTicks = stats.n_ticks - lrn.sigma_ticks;
+	lrn.simp_ticks_max = nConflicts ? stats.n_simpticks + searchTicks * opts.sigma_effort / 1000 : INT64_MAX;
+	lrn.sigma_ticks = stats.n_ticks;
+	stage("sigma");
 	backtrack();
 	if (BCP()) { cnfstate = UNSAT; return; }
 	shrink(orgs), shrink(learnts);
@@ -169,6 +211,7 @@ void ParaFROST::sigmify()
 	awaken();
 	if (!(cnfstate == UNSAT || sigState == AWAKEN_FAIL || sigState == SALLOC_FAIL) && !interrupted()) {
 		int64 before, diff;
+		uint32 melted = inf.maxMelted;
 		/********************************/
 		/*      V/C Eliminations        */
 		/********************************/
@@ -176,6 +219,7 @@ void ParaFROST::sigmify()
 		before = inf.nLiterals, diff = INT64_MAX;
 		while (true) {
 			// Stage 1
+			stage("sigma-prop");
 			resizeCNF();
 			createOT();
 			int p = prop();
@@ -183,25 +227,43 @@ void ParaFROST::sigmify()
 			else if (p < 0) break;
 
 			// Stage 2
+			stage("sigma-igr");
+			if (DCE()) reduceOT();
 			IGR();
 			if (cnfstate == UNSAT) break;
 
 			// Stage 3
+			stage("sigma-ce");
 			sortOT(false);
 			CE();
 
 			// Stage 4
+			stage("sigma-elim");
 			if (!LCVE()) break;
 			sortOT(true);
 			if (stop(diff)) { ERE(); break; }
-			HSE(), BVE(), BCE();
+			HSE(), BVE(), DCE(), BCE();
+			while (nextColor()) {
+				sortOT(true);
+				HSE(), BVE(), DCE(), BCE();
+			}
 
 			// Cleanup
 			countAll(), filterPVs();
+			if (exporting() && verbose < 2) recordPhase(melted);
 			inf.nClauses = inf.n_cls_after, inf.nLiterals = inf.n_lits_after;
 			diff = before - inf.nLiterals, before = inf.nLiterals;
-			phase++, mu_inc++;
-			mu_inc += phase == opts.phases;
+			phase++;
+			if (memPressure()) {
+				// keep the freezing temperatures, i.e. occurrence lists do not grow
+				PFLOG2(1, " Memory limit: keeping LCVE occurrence limits of phase %d", phase - 1);
+				stats.memsqueezes++;
+			}
+			else mu_inc++, mu_inc += phase == opts.phases;
+			if (stats.n_simpticks >= lrn.simp_ticks_max) {
+				PFLOG2(2, " SIGmA budget of %lld ticks exhausted after %d phases", lrn.simp_ticks_max, phase);
+				break;
+			}
 		}
 	}
 	if (cnfstate != UNSAT) {
@@ -210,7 +272,7 @@ void ParaFROST::sigmify()
 		/********************************/
 		assert(sp->propagated == trail.size());
 		if (interrupted()) killSolver();
-		occurs.clear(true), ot.clear(true), ig.clear(true);
+		occurs.clear(true), ot.clear(true), ig.clear(true), scratches.clear();
 		countFinal();
 		shrinkSimp(), assert(inf.nClauses == scnf.size());
 		stats.sigmifications++;
@@ -226,44 +288,28 @@ void ParaFROST::sigmify()
 		}
 	}
 	timer.stop(), timer.simp += timer.cpuTime();
+	if (opts.telemetry_path) publish();
 	if (!opts.solve_en) killSolver();
 	if (interrupted()) killSolver();
 	timer.start();
 }
 
 void ParaFROST::shrinkSimp() {
+	PFTRACE("shrinkSimp");
 	if (opts.profile_simp) timer.pstart();
 
-	std::vector<SCNF> partialSCNF(workerPool.count());
-	for (uint32 i = 0; i < partialSCNF.size(); i++) {
-		partialSCNF[i].reserve(scnf.size() * 2 / workerPool.count());
-	}
-
-	workerPool.doWorkForEach((size_t)0, scnf.size(), [&](size_t i) {
-		S_REF c = scnf[i];
-		uint32 ti = workerPool.getID();
-		assert(ti >= 0);
-
-		if (c->deleted()) removeClause(c);
-		else partialSCNF[ti].push(c);
+	workerPool.compact(scnf, [this](S_REF c) {
+		if (!c->deleted()) return true;
+		removeClause(c);
+		return false;
 	});
-	workerPool.join();
-
-	uint32 n = 0;
-	for (uint32 i = 0; i < partialSCNF.size(); i++) {
-		for (uint32 j = 0; j < partialSCNF[i].size(); j++) {
-			scnf[n++] = partialSCNF[i][j];
-		}
-		partialSCNF[i].clear(true);
-	}
-	scnf.resize(n);
 
 	if (opts.profile_simp) timer.pstop(), timer.gc += timer.pcpuTime();
 }
 
 void ParaFROST::newBeginning() {
 	assert(opts.sigma_en || opts.sigma_live_en);
-	assert(wt.empty());
+	assert(wt.empty() && wtBin.empty());
 	assert(orgs.empty());
 	assert(learnts.empty());
 	assert(inf.maxVar > vmap.numVars());
@@ -276,6 +322,7 @@ void ParaFROST::newBeginning() {
 	inf.nOrgLits = inf.nLiterals;
 	scnf.clear(true);
 	wt.resize(mapped ? V2L(vmap.size()) : inf.nDualVars);
+	wtBin.resize(wt.size());
 	rebuildWT(opts.priorbins_en);
 	printStats(1, 'p', CGREEN);
 }
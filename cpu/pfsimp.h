@@ -22,6 +22,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "pfsort.h"
 #include "pfsolve.h" 
 #include "pfrange.h"
+#include "pfchash.h"
 #include "scc_wrapper.h"
 
 #include <atomic>
@@ -60,6 +61,11 @@ namespace SIGmA {
 			return false;
 		}
 	};
+	struct CNF_CMP_ID {
+		bool operator () (S_REF x, S_REF y) {
+			return x->id() < y->id();
+		}
+	};
 	struct CNF_CMP_KEY {
 		bool operator () (S_REF x, S_REF y) {
 			if (x->size() != y->size()) return x->size() < y->size();
@@ -122,11 +128,18 @@ namespace SIGmA {
 		return found == 3;
 	}
 
+	// a clause read costs its header plus the cache lines of its literals;
+	// a list walk costs its cache lines plus one tick per referenced clause
+	inline int64 clauseTicks(const S_REF c) { return 1 + cacheLines(size_t(c->size()) * sizeof(uint32)); }
+	inline void pairTicks(const S_REF c1, const S_REF c2) { simpTicks += clauseTicks(c1) + clauseTicks(c2); }
+	inline void listTicks(const OL& ol) { simpTicks += 1 + cacheLines(size_t(ol.size()) * sizeof(S_REF)) + ol.size(); }
+
 	inline bool isTautology(const uint32& elim_v, const S_REF c1, const S_REF c2)
 	{
 		assert(elim_v > 0);
 		assert(!c1->deleted());
 		assert(!c2->deleted());
+		pairTicks(c1, c2);
 		int it1 = 0, it2 = 0;
 		while (it1 < c1->size() && it2 < c2->size()) {
 			uint32 v1 = ABS(c1->lit(it1)), v2 = ABS(c2->lit(it2));
@@ -145,6 +158,7 @@ namespace SIGmA {
 		assert(elim_v > 0);
 		assert(c1->original());
 		assert(c2->original());
+		pairTicks(c1, c2);
 		out_c.clear();
 		int it1 = 0, it2 = 0;
 		uint32 lit1, lit2, v1, v2;
@@ -178,6 +192,7 @@ namespace SIGmA {
 		assert(elim_var);
 		assert(!c1->deleted());
 		assert(!c2->deleted());
+		pairTicks(c1, c2);
 		out_c.clear();
 		int it1 = 0, it2 = 0;
 		uint32 lit1, lit2, v1, v2;
@@ -288,6 +303,15 @@ namespace SIGmA {
 		return true;
 	}
 
+	inline bool isEqual(const SCLAUSE& c1, const SCLAUSE& c2)
+	{
+		assert(!c1.deleted() && !c2.deleted());
+		assert(c1.size() == c2.size());
+		for (int k = 0; k < c1.size(); k++)
+			if (c1[k] != c2[k]) return false;
+		return true;
+	}
+
 	inline void cswap(uint32& x, uint32& y)
 	{
 		uint32 ta = std::min(x, y);
@@ -306,6 +330,7 @@ namespace SIGmA {
 		if (ot[y].size() > ot[z].size()) swap(y, z);
 		if (ot[x].size() > ot[y].size()) swap(x, y);
 		OL& list = ot[x];
+		listTicks(list);
 		sort3(x, y, z);
 		assert(x <= y && y <= z && x <= z);
 		for (S_REF* i = list; i != list.end(); i++) {
@@ -332,6 +357,7 @@ namespace SIGmA {
 			m_sig |= MAPHASH(m_c[k]);
 		}
 		OL& minList = ot[best];
+		listTicks(minList);
 		for (int i = 0; i < minList.size(); i++) {
 			CL_ST st = minList[i]->status();
 			if (msize == minList[i]->size() && ((st & LEARNT) || (st & type)) &&
@@ -344,6 +370,26 @@ namespace SIGmA {
 		}
 	}
 
+	// same as above but the candidates are looked up in a hash index;
+	// returns true if an equal clause was found
+	inline bool forward_equ(Lits_t& m_c, CHASH& index, const CL_ST& type)
+	{
+		pfrost->getStats().n_triedreduns++;
+		int msize = m_c.size();
+		assert(msize > 1);
+		simpTicks++;
+		S_REF c = index.find(CHASH::hash(m_c, msize), [&](const S_REF d) {
+			if (d->deleted() || d->size() != msize) return false;
+			CL_ST st = d->status();
+			return ((st & LEARNT) || (st & type)) && isEqual(*d, m_c);
+		});
+		if (!c) return false;
+		c->markDeleted();  //  HR found --> eliminate
+		if (c->learnt()) pfrost->getStats().n_lrnreduns++;
+		else pfrost->getStats().n_orgreduns++;
+		return true;
+	}
+
 	inline void updateOL(OL& ol)
 	{
 		if (ol.empty()) return;
@@ -363,6 +409,7 @@ namespace SIGmA {
 		assert(sm->size() > 1);
 		assert(lr->size() > 1);
 		assert(sm->size() <= lr->size());
+		pairTicks(sm, lr);
 		int it1 = 0, it2 = 0, sub = 0;
 		while (it1 < sm->size() && it2 < lr->size()) {
 			if (sm->lit(it1) < lr->lit(it2)) return false;
@@ -380,6 +427,7 @@ namespace SIGmA {
 		assert(sm->size() > 1);
 		assert(lr->size() > 1);
 		assert(sm->size() <= lr->size());
+		pairTicks(sm, lr);
 		int it1 = 0, it2 = 0, sub = 0;
 		bool self = false;
 		while (it1 < sm->size() && it2 < lr->size()) {
@@ -467,6 +515,7 @@ namespace SIGmA {
 			}
 		}
 		OL& minlist = ot[best];
+		listTicks(minlist);
 		for (S_REF* i = minlist; i != minlist.end(); i++) {
 			SCLAUSE& c = **i;
 			if (c.original() && c.size() == size && checkArity(c, literals, size)) {
@@ -481,6 +530,7 @@ namespace SIGmA {
 	inline void countOrgs(OL& list, int& orgs)
 	{
 		assert(!orgs);
+		listTicks(list);
 		for (S_REF* i = list; i != list.end(); i++)
 			if ((*i)->original()) orgs++;
 	}
@@ -589,6 +639,7 @@ namespace SIGmA {
 		assert(gate_out > 1);
 		uint32 imp = 0;
 		int nImps = 0;
+		listTicks(list);
 		for (S_REF* i = list; i != list.end(); i++) {
 			SCLAUSE& c = **i;
 			if (c.original() && c.size() == 2) {
@@ -610,6 +661,7 @@ namespace SIGmA {
 		if (first) {
 			uint32 second = n, def = first;
 			if (second < first) first = second, second = def;
+			listTicks(negs);
 			for (int i = 0; i < negs.size(); i++) {
 				SCLAUSE& c = *negs[i];
 				if (c.learnt()) continue;
@@ -631,6 +683,7 @@ namespace SIGmA {
 		out_c.clear();
 		sig = 0;
 		uint32 imp = 0;
+		listTicks(list);
 		for (S_REF* i = list; i != list.end(); i++) {
 			SCLAUSE& c = **i;
 			if (c.learnt()) continue;
@@ -662,6 +715,7 @@ namespace SIGmA {
 			sig |= MAPHASH(f_dx);
 			Sort(out_c, LESS<uint32>());
 			OL& otarget = ot[f_dx];
+			listTicks(otarget);
 			for (int i = 0; i < otarget.size(); i++) {
 				SCLAUSE& c = *otarget[i];
 				if (c.learnt()) continue;
@@ -695,6 +749,7 @@ namespace SIGmA {
 	{
 		assert(checkMolten(ot[dx], ot[FLIP(dx)]));
 		OL& itarget = ot[dx];
+		listTicks(itarget);
 		for (S_REF* i = itarget; i != itarget.end(); i++) {
 			SCLAUSE& ci = **i;
 			if (ci.learnt() || ci.size() < 3 || ci.size() > 3) continue;
@@ -752,6 +807,7 @@ namespace SIGmA {
 		assert(checkMolten(ot[dx], ot[fx]));
 		OL& itarget = ot[dx];
 		OL& otarget = ot[fx];
+		listTicks(itarget);
 		for (S_REF* i = itarget; i != itarget.end(); i++) {
 			SCLAUSE& ci = **i;
 			if (ci.original()) {
@@ -835,8 +891,75 @@ namespace SIGmA {
 		return true;
 	}
 
+	// same as 'resolve_x' with the pairs of every positive clause checked
+	// and resolved by a separate job, resolvents keep the sequential order.
+	// The ticks charged by the workers are summed after each join
+	inline bool resolve_x_split(const uint32& x, const int& pOrgs, const int& nOrgs, OL& poss, OL& negs, SCNF& new_res, const bool& bound)
+	{
+		assert(x);
+		assert(checkMolten(poss, negs));
+		WorkerPool& pool = pfrost->workerPool;
+		Vec<int64> ticks(pool.count(), 0);
+		auto counted = [&](const auto& job) {
+			return [&, job](int i) {
+				const int64 before = simpTicks;
+				job(i);
+				ticks[pool.getID()] += simpTicks - before;
+			};
+		};
+		auto charge = [&]() {
+			for (uint32 w = 0; w < ticks.size(); w++)
+				pfrost->getStats().n_simpticks += ticks[w], ticks[w] = 0;
+		};
+		// check resolvability
+		std::atomic<int> nTs = 0, nAddedLits = 0;
+		pool.doWorkForEach(0, poss.size(), counted([&](int i) {
+			if (poss[i]->learnt()) return;
+			int ts = 0, lits = 0;
+			for (int j = 0; j < negs.size(); j++) {
+				if (negs[j]->learnt()) continue;
+				if (isTautology(x, poss[i], negs[j])) ts++;
+				else lits += poss[i]->size() + negs[j]->size() - 2;
+			}
+			nTs += ts, nAddedLits += lits;
+		}));
+		pool.join();
+		charge();
+		assert(pOrgs * nOrgs >= nTs);
+		int nAddedCls = pOrgs * nOrgs - nTs;
+		if (nAddedCls == 0) return true; // No resolvents to add
+		if (nAddedCls > pOrgs + nOrgs) return false;
+		// count literals before elimination
+		if (bound) {
+			int lits_before = 0;
+			countLitsBefore(poss, lits_before);
+			countLitsBefore(negs, lits_before);
+			if (nAddedLits > lits_before) return false;
+		}
+		// can be eliminated
+		std::vector<SCNF> rows(poss.size());
+		pool.doWorkForEach(0, poss.size(), counted([&](int i) {
+			if (poss[i]->learnt()) return;
+			Lits_t& out_c = pfrost->scratch().lits;
+			for (int j = 0; j < negs.size(); j++) {
+				if (negs[j]->learnt()) continue;
+				if (!isTautology(x, poss[i], negs[j])) {
+					merge(x, poss[i], negs[j], out_c);
+					rows[i].push(new SCLAUSE(out_c));
+				}
+			}
+		}));
+		pool.join();
+		charge();
+		for (int i = 0; i < poss.size(); i++)
+			for (uint32 j = 0; j < rows[i].size(); j++)
+				new_res.push(rows[i][j]);
+		return true;
+	}
+
 	inline void sub_x(S_REF& c, OL& other)
 	{
+		listTicks(other);
 		for (int j = 0; j < other.size(); j++) {
 			S_REF d = other[j];
 			if (d->deleted()) continue;
@@ -855,6 +978,7 @@ namespace SIGmA {
 
 	inline void self_sub_x(const uint32& lit, S_REF& c, OL& other)
 	{
+		listTicks(other);
 		for (int j = 0; j < other.size(); j++) {
 			S_REF d = other[j];
 			uint32 lit = 0;
@@ -898,6 +1022,7 @@ namespace SIGmA {
 	inline bool is_blocked_x(const uint32& x, S_REF& c, OL& other)
 	{
 		bool allTautology = true;
+		listTicks(other);
 		for (int j = 0; j < other.size(); j++) {
 			S_REF d = other[j];
 			if (d->deleted() || d->learnt()) continue;
@@ -921,58 +1046,81 @@ namespace SIGmA {
 		}
 	}
 
-	inline void clause_elim(S_REF& c, OT& ot, IG& ig)
+	// clauses subsumed by 'c' (modulo hidden literals with HLA) into 'subsumed'
+	inline void rse_collect(const S_REF c, OT& ot, IG& ig, OL& subsumed)
 	{
-		// RSE
-		if (pfrost->opts.hse_en && !c->deleted() && c->size() <= pfrost->opts.rse_max) {
-			CNF_CMP_ABS less;
-			OL subsumed;
+		CNF_CMP_ABS less;
+		SCRATCH& sc = pfrost->scratch();
+		subsumed.clear();
 
-			for (int k = 0; k < c->size(); k++) {
-				uint32 lit = c->lit(k);
-				OL& ol = ot[lit];
-				OL* candidates = nullptr;
-
-				if (pfrost->opts.hla_en) {
-					candidates = new OL(ol);
+		for (int k = 0; k < c->size(); k++) {
+			uint32 lit = c->lit(k);
+			OL& ol = ot[lit];
+			OL* candidates = nullptr;
+
+			if (pfrost->opts.hla_en) {
+				candidates = &sc.cands;
+				candidates->copyFrom(ol);
+				if (ig[lit].isExplored() || ig[lit].isReduced()) {
 					for (uint32 i = 0; i < ig[lit].descendants().size(); i++) {
 						uint32 aug = ig[lit].descendants()[i];
-						candidates->unionize(ot[aug]);
+						candidates->unionize(ot[aug], sc.mergedOL, less);
 					}
 				}
-				else {
-					candidates = &ol;
+				else { // descendants are not gathered by transitive reduction
+					const EdgeRange cs = ig.children(lit);
+					for (uint32 i = 0; i < cs.size(); i++) {
+						if (!cs[i].second->deleted()) candidates->unionize(ot[cs[i].first], sc.mergedOL, less);
+					}
 				}
+			}
+			else {
+				candidates = &ol;
+			}
 
-				if (k == 0) {
-					subsumed.copyFrom(*candidates);
-					if (!pfrost->opts.hla_en) {
-						int i = 0, n = 0;
-						while (i < subsumed.size()) {
-							S_REF& d = subsumed[i];
-							if (subset_sig(c->sig(), d->sig())) subsumed[n++] = subsumed[i];
-							i++;
-						}
+			if (k == 0) {
+				subsumed.copyFrom(*candidates);
+				if (!pfrost->opts.hla_en) {
+					int i = 0, n = 0;
+					while (i < subsumed.size()) {
+						S_REF& d = subsumed[i];
+						if (subset_sig(c->sig(), d->sig())) subsumed[n++] = subsumed[i];
+						i++;
 					}
 				}
-				else {
-					int i = 0, j = 0, n = 0;
-					while (i < subsumed.size() && j < candidates->size()) {
-						S_REF& d1 = subsumed[i], & d2 = (*candidates)[j];
-						if (d1->deleted() || less(d1, d2)) i++;
-						else if (d2->deleted() || less(d2, d1)) j++;
-						else if (d1 != c) { subsumed[n++] = subsumed[i++]; j++; }
-						else { i++; j++; }
-					}
-					subsumed.resize(n);
+			}
+			else {
+				int i = 0, j = 0, n = 0;
+				while (i < subsumed.size() && j < candidates->size()) {
+					S_REF& d1 = subsumed[i], & d2 = (*candidates)[j];
+					if (d1->deleted() || less(d1, d2)) i++;
+					else if (d2->deleted() || less(d2, d1)) j++;
+					else if (d1 != c) { subsumed[n++] = subsumed[i++]; j++; }
+					else { i++; j++; }
 				}
+				subsumed.resize(n);
+			}
 
-				if (pfrost->opts.hla_en) {
-					delete candidates;
-				}
+			if (subsumed.empty()) break;
+		}
+	}
 
-				if (subsumed.empty()) break;
-			}
+	inline bool clause_blocked(S_REF c, OT& ot)
+	{
+		for (int k = 0; k < c->size(); k++) {
+			OL& ol = ot[FLIP(c->lit(k))];
+			if (ol.size() <= pfrost->opts.bce_limit && is_blocked_x(ABS(c->lit(k)), c, ol))
+				return true;
+		}
+		return false;
+	}
+
+	inline void clause_elim(S_REF& c, OT& ot, IG& ig)
+	{
+		// RSE
+		if (pfrost->opts.hse_en && !c->deleted() && c->size() <= pfrost->opts.rse_max) {
+			OL& subsumed = pfrost->scratch().subsumed;
+			rse_collect(c, ot, ig, subsumed);
 
 			bool promote = false;
 			c->lock();
@@ -982,7 +1130,7 @@ namespace SIGmA {
 					if (d->tryLock()) {
 						if (!d->deleted()) {
 							if (d->original()) promote = true;
-							assert(!subset(c, d));
+							assert(pfrost->opts.hla_en || subset(c, d));
 							if (c->size() < d->size()) d->markDeleted();
 						}
 						d->unlock();
@@ -994,43 +1142,15 @@ namespace SIGmA {
 		}
 
 		// BCE
-		if (pfrost->opts.bce_en && !c->deleted() && !c->learnt() && c->size() > 2) {
-			for (int k = 0; k < c->size() && !c->deleted(); k++) {
-				OL& ol = ot[FLIP(c->lit(k))];
-				if (ol.size() <= pfrost->opts.bce_limit && is_blocked_x(ABS(c->lit(k)), c, ol))
-					c->markDeleted();
-			}
-		}
+		if (pfrost->opts.bce_en && !c->deleted() && !c->learnt() && c->size() > 2 && clause_blocked(c, ot))
+			c->markDeleted();
 	}
 
+	// edges become visible after the next 'ig.commit()'
 	inline void insert_ig_edge(const S_REF& c, IG& ig)
 	{
 		assert(c->size() == 2);
-
-		uint32 lit1 = c->lit(0), lit2 = c->lit(1);
-		ig[lit1].lock(); ig[lit1].insertParent(FLIP(lit2), c); ig[lit1].unlock();
-		ig[lit2].lock(); ig[lit2].insertParent(FLIP(lit1), c); ig[lit2].unlock();
-		ig[FLIP(lit1)].lock(); ig[FLIP(lit1)].insertChild(lit2, c); ig[FLIP(lit1)].unlock();
-		ig[FLIP(lit2)].lock(); ig[FLIP(lit2)].insertChild(lit1, c); ig[FLIP(lit2)].unlock();
-	}
-
-	inline void append_ig_edge(const S_REF& c, IG& ig)
-	{
-		assert(c->size() == 2);
-
-		uint32 lit1 = c->lit(0), lit2 = c->lit(1);
-		ig[lit1].lock(); ig[lit1].appendParent(FLIP(lit2), c); ig[lit1].unlock();
-		ig[lit2].lock(); ig[lit2].appendParent(FLIP(lit1), c); ig[lit2].unlock();
-		ig[FLIP(lit1)].lock(); ig[FLIP(lit1)].appendChild(lit2, c); ig[FLIP(lit1)].unlock();
-		ig[FLIP(lit2)].lock(); ig[FLIP(lit2)].appendChild(lit1, c); ig[FLIP(lit2)].unlock();
-	}
-
-	inline void delete_ig_edge(const uint32& lit1, const uint32& lit2, IG& ig)
-	{
-		ig[lit1].lock(); ig[lit1].deleteParent(FLIP(lit2)); ig[lit1].unlock();
-		ig[lit2].lock(); ig[lit2].deleteParent(FLIP(lit1)); ig[lit2].unlock();
-		ig[FLIP(lit1)].lock(); ig[FLIP(lit1)].deleteChild(lit2); ig[FLIP(lit1)].unlock();
-		ig[FLIP(lit2)].lock(); ig[FLIP(lit2)].deleteChild(lit1); ig[FLIP(lit2)].unlock();
+		ig.stage(c, pfrost->workerPool.getID());
 	}
 
 	inline bool clause_replace(const S_REF& c, const uint32& oldLit, const uint32& newLit, IG& ig, OL& newUnit)
@@ -1070,12 +1190,8 @@ namespace SIGmA {
 		}
 		else if (c->size() == 2) {
 			bool newEdge = false;
-			uint32 otherLit = 0;
-			if (c->lit(1) == newLit) otherLit = c->lit(0);
-			else otherLit = c->lit(1);
-
-			if (prevSize == 2) delete_ig_edge(oldLit, otherLit, ig);
-			else newEdge = true;
+			// old edges of a replaced binary are dropped on commit
+			if (prevSize != 2) newEdge = true;
 
 			insert_ig_edge(c, ig);
 			return newEdge;
@@ -1115,6 +1231,7 @@ namespace SIGmA {
 			// Mark node as reduced and add reference to the node it was replaced with.
 			ig[oldLit].lock();
 			ig[oldLit].clear(true);
+			ig.isolate(oldLit);
 			ig[oldLit].markReduced();
 			ig[oldLit].descendants().push(newLit);
 			ig[oldLit].unlock();
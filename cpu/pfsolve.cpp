@@ -30,7 +30,7 @@ using namespace pFROST;
 //=======================================//
 ParaFROST::ParaFROST(const string& _path) :
 	path(_path)
-	, vsids(HEAP_CMP(activity))
+	, vsids(activity)
 	, starts(1)
 	, nConflicts(0)
 	, intr(false)
@@ -40,10 +40,22 @@ ParaFROST::ParaFROST(const string& _path) :
 	, sigState(AWAKEN_SUCC)
 {
 	opts.init();
+	if (opts.mmap_en) {
+		// before any arena, watch table or variable block exists
+		pages.cats = (1U << MEM_CMM) | (1U << MEM_WT) | (1U << MEM_SP);
+		pages.minBytes = size_t(opts.mmap_min) * KBYTE;
+		pages.huge = opts.hugepages_en, pages.numa = opts.numa_en;
+	}
+	wt.tag(MEM_WT), wtBin.tag(MEM_WT), ot.tag(MEM_OT), scnf.tag(MEM_SCNF);
 	workerPool.init(opts.worker_count, opts.batch_max);
 	stats.sysMemAvail = getAvailSysMem();
 	getCPUInfo();
 	PFLOG2(1, " Available system memory = %lld GB", stats.sysMemAvail / GBYTE);
+	if (opts.mem_limit) {
+		const int64 limit = int64(opts.mem_limit) * MBYTE;
+		if (limit < stats.sysMemAvail) stats.sysMemAvail = limit;
+		PFLOG2(1, " Memory limit = %.2f MB, degrading above %.2f MB", (double)stats.sysMemAvail / MBYTE, double(stats.sysMemAvail / 1000 * opts.mem_pressure) / MBYTE);
+	}
 	if (opts.proof_en) PFLOGE("generating proof is currently unsupported");
 	if (!parser() || BCP()) { cnfstate = UNSAT, killSolver(); }
 	if (opts.parse_only_en) killSolver();
@@ -132,6 +144,7 @@ void ParaFROST::allocSolver()
 	orgs.resize(inf.nOrgCls);
 	// watch table
 	wt.resize(inf.nDualVars);
+	wtBin.resize(inf.nDualVars);
 	// variable arrays
 	trail.reserve(inf.maxVar);
 	dlevels.reserve(inf.maxVar);
@@ -181,21 +194,28 @@ void ParaFROST::resetSolver() {
 void ParaFROST::solve()
 {
 	timer.start();
-	if (canPreSigmify()) sigmify();
+	if (opts.telemetry_path) telemetry.start(opts.telemetry_path, opts.telemetry_period);
+	if (opts.trace_path) tracer.start(opts.trace_size);
+	if (canPreSigmify()) sigmify(), stage("search");
 	PFLOG2(2, "-- CDCL search started..");
 	if (cnfstate == UNSOLVED) MDMInit();
 	while (cnfstate == UNSOLVED) {
-		if (opts.timeout > 0 && timer.checkTimeout()) handler_mercy_timeout(0);
+		if (opts.timeout > 0 && stats.n_ticks >= lrn.timeout_ticks_max) {
+			// the clock is read once every 'timeout_ticks' search ticks
+			lrn.timeout_ticks_max = stats.n_ticks + opts.timeout_ticks;
+			if (timer.checkTimeout()) handler_mercy_timeout(0);
+		}
 		if (interrupted()) break;
+		if (canExport()) exportStats();
 		PFLDL(this, 3);
 		if (BCP()) analyze();
 		else if (satisfied()) cnfstate = SAT;
 		else if (canRestart()) restart();
 		else if (canRephase()) rephase();
-		else if (canReduce()) reduce();
-		else if (canSubsume()) subsume();
-		else if (canSigmify()) sigmify();
-		else if (canMMD()) MDM();
+		else if (canReduce()) stage("reduce"), reduce(), stage("search");
+		else if (canSubsume()) stage("subsume"), subsume(), stage("search");
+		else if (canSigmify()) sigmify(), stage("search");
+		else if (canMMD()) stage("mdm"), MDM(), stage("search");
 		else decide();
 		PFLTRAIL(this, 3);
 	}
@@ -227,14 +247,19 @@ void ParaFROST::report()
 			PFLOG1("  - HSE                 : %-10.2f  ms", timer.hse);
 			PFLOG1("  - BCE                 : %-10.2f  ms", timer.bce);
 			PFLOG1("  - ERE                 : %-10.2f  ms", timer.ere);
+			PFLOG1("  - DCE                 : %-10.2f  ms", timer.dce);
 		}
 		PFLOG0("\t\t\tSolver Report");
 		PFLOG1(" Solver time            : %-10.3f  sec", timer.solve);
 		PFLOG1(" System memory          : %-10.3f  MB", ((double)sysMemUsed() / MBYTE));
+		PFLOG1(" Tracked memory         : %-10.3f  MB (peak %.3f MB)", (double)memAccount.total() / MBYTE, (double)memAccount.totalPeak() / MBYTE);
+		for (Byte i = 0; i < MEM_CATS; i++)
+			PFLOG1("  - %-20s: %-10.3f  MB (peak %.3f MB)", memAccount.name(i), (double)memAccount.live(i) / MBYTE, (double)memAccount.peak(i) / MBYTE);
 		PFLOG1(" Reduces                : %-10lld", (int64) stats.reduces);
 		PFLOG1(" Rephases               : %-10lld", (int64) stats.n_rephs);
 		PFLOG1(" Random rephases        : %-10lld", (int64) stats.n_randrephs);
 		PFLOG1(" Recyclings             : %-10lld", (int64) stats.recyclings);
+		if (opts.mem_limit) PFLOG1(" Memory squeezes        : %-10lld", (int64) stats.memsqueezes);
 		PFLOG1(" Shrinkages             : %-10d", (int) stats.shrinkages);
 		PFLOG1(" Sigmifications         : %-10d", (int) stats.sigmifications);
 		PFLOG1(" Mappings               : %-10d", (int) stats.mappings);
@@ -250,10 +275,15 @@ void ParaFROST::report()
 		PFLOG1(" Tried redundancies     : %-10lld", (int64) stats.n_triedreduns);
 		PFLOG1(" Original redundancies  : %-10lld", (int64) stats.n_orgreduns);
 		PFLOG1(" Learnt redundancies    : %-10lld", (int64) stats.n_lrnreduns);
+		PFLOG1(" Duplicate clauses      : %-10lld", (int64) stats.n_duplicates);
+		PFLOG1(" ERE index hits/misses  : %lld/%lld", (int64) stats.n_erehits, (int64) stats.n_eremisses);
 		PFLOG1(" MDM calls              : %-10d", (int) stats.mdm_calls);
 		PFLOG1(" Multiple decisions     : %-10lld  (%.1f dec/sec)", (int64) stats.n_mds, stats.n_mds / timer.solve);
 		PFLOG1(" Follow-Up decisions    : %-10lld  (%.1f dec/sec)", (int64) stats.n_fuds, stats.n_fuds / timer.solve);
 		PFLOG1(" Propagations           : %-10lld  (%.1f prop/sec)", (int64) stats.n_props, stats.n_props / timer.solve);
+		PFLOG1(" Search ticks           : %-10lld  (%.1f ticks/prop)", (int64) stats.n_ticks, ratio((double)stats.n_ticks, (double)stats.n_props));
+		PFLOG1(" Simplifier ticks       : %-10lld", (int64) stats.n_simpticks);
+		PFLOG1(" Subsume ticks (budget) : %-10lld", (int64) stats.n_subticks);
 		PFLOG1(" Chronological     BT   : %-10lld  (%.1f bt/sec)", (int64) stats.cbt, stats.cbt / timer.solve);
 		PFLOG1(" Non-Chronological BT   : %-10lld  (%.1f bt/sec)", (int64) stats.ncbt, stats.ncbt / timer.solve);
 		PFLOG1(" Trail reuses           : %-10lld  (%.1f r/sec)", (int64) stats.reuses, stats.reuses / timer.solve);
@@ -264,8 +294,86 @@ void ParaFROST::report()
 	}
 }
 
+// Rewrite the statistics files requested by '--statsjson' and
+// '--statscsv'; periodic snapshots report a running status
+void ParaFROST::exportStats(const bool& final)
+{
+	if (opts.stats_period) lrn.stats_conf_max = nConflicts + opts.stats_period;
+	REPORT& r = statsReport;
+	r.clear();
+	const char* status = !final ? "RUNNING" : cnfstate == SAT ? "SAT" : cnfstate == UNSAT ? "UNSAT" : "UNKNOWN";
+	r.add("result", "status", status);
+	r.add("result", "conflicts", (int64)nConflicts);
+	r.add("result", "restarts", (int64)starts);
+	r.add("formula", "original_vars", (int64)inf.orgVars);
+	r.add("formula", "original_clauses", (int64)inf.nOrgCls);
+	r.add("formula", "original_literals", (int64)inf.nOrgLits);
+	r.add("formula", "active_vars", (int64)maxActive());
+	r.add("formula", "clauses", (int64)inf.nClauses);
+	r.add("formula", "literals", (int64)inf.nLiterals);
+	r.add("formula", "learnt_literals", (int64)inf.nLearntLits);
+#define EXPORT_STAT(FIELD) r.add("stats", #FIELD, (int64)stats.FIELD)
+	EXPORT_STAT(n_rephs), EXPORT_STAT(n_randrephs);
+	EXPORT_STAT(n_subchecks), EXPORT_STAT(n_subcalls);
+	EXPORT_STAT(n_allsubsumed), EXPORT_STAT(n_allstrengthened), EXPORT_STAT(n_learntsubs);
+	EXPORT_STAT(n_triedreduns), EXPORT_STAT(n_orgreduns), EXPORT_STAT(n_lrnreduns);
+	EXPORT_STAT(n_erehits), EXPORT_STAT(n_eremisses), EXPORT_STAT(n_duplicates);
+	EXPORT_STAT(n_fuds), EXPORT_STAT(n_mds);
+	EXPORT_STAT(n_units), EXPORT_STAT(n_props), EXPORT_STAT(n_forced);
+	EXPORT_STAT(n_ticks), EXPORT_STAT(n_simpticks), EXPORT_STAT(n_subticks);
+	EXPORT_STAT(tot_lits), EXPORT_STAT(max_lits), EXPORT_STAT(n_glues);
+	EXPORT_STAT(reuses), EXPORT_STAT(reduces), EXPORT_STAT(recyclings), EXPORT_STAT(memsqueezes);
+	EXPORT_STAT(stab_restarts), EXPORT_STAT(ncbt), EXPORT_STAT(cbt);
+	EXPORT_STAT(sigmifications);
+	EXPORT_STAT(marker), EXPORT_STAT(mdm_calls);
+	EXPORT_STAT(mappings), EXPORT_STAT(shrinkages);
+#undef EXPORT_STAT
+	// the search timer is only added to 'solve' after sigmify and at the end
+	const double solveTime = final ? timer.solve : timer.solve + timer.elapsed();
+	r.add("stats", "props_per_sec", solveTime > 0 ? stats.n_props / solveTime : 0.0);
+	r.add("learn", "subtried", (int64)lrn.subtried);
+	r.add("time_sec", "parse", (double)timer.parse);
+	r.add("time_sec", "solve", solveTime);
+	r.add("time_sec", "simp", (double)timer.simp);
+	r.add("time_ms", "vo", (double)timer.vo);
+	r.add("time_ms", "gc", (double)timer.gc);
+	r.add("time_ms", "cot", (double)timer.cot);
+	r.add("time_ms", "sot", (double)timer.sot);
+	r.add("time_ms", "rot", (double)timer.rot);
+	r.add("time_ms", "igr", (double)timer.igr);
+	for (int i = 0; i < IGR_COUNT; i++) {
+		const string key = "igr_part" + std::to_string(i);
+		r.add("time_ms", key.c_str(), (double)timer.igr_part[i]);
+	}
+	r.add("time_ms", "ce", (double)timer.ce);
+	r.add("time_ms", "ve", (double)timer.ve);
+	r.add("time_ms", "hse", (double)timer.hse);
+	r.add("time_ms", "bce", (double)timer.bce);
+	r.add("time_ms", "ere", (double)timer.ere);
+	r.add("time_ms", "dce", (double)timer.dce);
+	r.add("time_ms", "io", (double)timer.io);
+	r.add("memory", "system_used", (int64)sysMemUsed());
+	r.add("memory", "system_available", (int64)stats.sysMemAvail);
+	r.add("memory", "tracked", memAccount.total());
+	r.add("memory", "tracked_peak", memAccount.totalPeak());
+	for (Byte i = 0; i < MEM_CATS; i++) {
+		const string key = memAccount.name(i);
+		r.add("memory", key.c_str(), memAccount.live(i));
+		r.add("memory", (key + "_peak").c_str(), memAccount.peak(i));
+	}
+	r.add("memory", "clause_arena", int64(cm.size() * cm.bucket()));
+	r.add("memory", "clause_garbage", int64(cm.garbage() * cm.bucket()));
+	if (opts.stats_json && !r.writeJSON(opts.stats_json))
+		PFLOGW("cannot write statistics to \"%s\"", opts.stats_json);
+	if (opts.stats_csv && !r.writeCSV(opts.stats_csv))
+		PFLOGW("cannot write statistics to \"%s\"", opts.stats_csv);
+}
+
 void ParaFROST::wrapup() {
 	if (opts.proof_en) proofFile.close();
+	if (opts.telemetry_path) publish(), telemetry.stop();
+	if (opts.trace_path && !tracer.dump(opts.trace_path))
+		PFLOGW("cannot write trace to \"%s\"", opts.trace_path);
 	if (!quiet_en) { PFLRULER('-', RULELEN); PFLOG0(""); }
 	if (cnfstate == SAT) {
 		PFLOGS("SATISFIABLE");
@@ -277,4 +385,5 @@ void ParaFROST::wrapup() {
 	else if (cnfstate == UNSAT) PFLOGS("UNSATISFIABLE");
 	else if (cnfstate == UNSOLVED) PFLOGS("UNKNOWN");
 	if (opts.report_en) report();
+	if (exporting()) exportStats(true);
 }
\ No newline at end of file
@@ -32,6 +32,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "pfoptions.h"
 #include "pfnode.h"
 #include "pfworker.h"
+#include "pfscratch.h"
+#include "pfreport.h"
+#include "pftelemetry.h"
 #include <atomic>
 #include <algorithm>
 
@@ -50,7 +53,7 @@ namespace pFROST {
 		SP				*sp;
 		LEARN			lrn;
 		STATS			stats;
-		WT				wt;
+		WT				wt, wtBin;
 		BCNF			orgs, learnts, reduced;
 		VMAP			vmap;
 		MODEL			model;
@@ -66,7 +69,11 @@ namespace pFROST {
 		uVec1D			trail, dlevels;
 		uVec1D          eligible, analyzed, minimized;
 		uVec1D          vorg, subhist;
+#ifdef VSIDS_DHEAP
+		DHEAP<VSIDS_DHEAP>	vsids;
+#else
 		HEAP<HEAP_CMP>	vsids;
+#endif
 		QUEUE			vmfq;
 		LBDREST			lbdrest;
 		LUBYREST		lubyrest;
@@ -76,6 +83,8 @@ namespace pFROST {
 		size_t			solLineLen;
 		string			solLine;
 		std::ofstream	proofFile;
+		REPORT			statsReport;
+		TELEMETRY		telemetry;
 		bool			intr;
 	public:
 		OPTION			opts;
@@ -84,13 +93,12 @@ namespace pFROST {
 		inline void		strengthen			(CLAUSE&, const uint32&);
 		inline int		removeRooted		(CLAUSE&);
 		inline void		removeSubsumed		(CLAUSE&, const C_REF&, CLAUSE*, const C_REF&);
-		inline bool		depFreeze			(WL&, const uint32&);
-		inline bool		valid				(WL&);
-		inline void		recycleWL			(WL&, CMM&);
-		inline void		recycleWL			(const uint32&);
+		inline bool		depFreeze			(const WL&, const uint32&);
+		inline bool		valid				(const WL&);
+		inline void		recycleWL			(const WL&, CMM&);
 		inline void		reduceWeight		(double&);
 		inline void		savePhases			(const int&);
-		inline CL_ST	subsumeClause		(const C_REF&, CLAUSE&, BCNF&);
+		inline CL_ST	subsumeClause		(const C_REF&, CLAUSE&, BCNF&, int64&);
 		inline bool		subsumeCheck		(CLAUSE*, uint32&);
 		inline void		bumpClause			(CLAUSE&);
 		inline void		moveClause			(C_REF&, CMM&);
@@ -133,8 +141,41 @@ namespace pFROST {
 		inline bool		canPreSigmify		() const { return opts.sigma_en; }
 		inline bool		canMMD				() const { return lrn.rounds && varsEnough(); }
 		inline bool		canRephase			() const { return opts.rephase_en && nConflicts > lrn.rephase_conf_max; }
-		inline bool		canReduce			() const { return opts.reduce_en && learnts.size() && nConflicts >= lrn.reduce_conf_max; }
-		inline bool		canCollect			() const { return cm.garbage() > (cm.size() * opts.gc_perc); }
+		inline bool		canReduce			() const {
+			if (!opts.reduce_en || learnts.empty()) return false;
+			return nConflicts >= lrn.reduce_conf_max || (nConflicts >= lrn.mem_reduce_conf_max && memPressure());
+		}
+		// tracked memory beyond the pressure mark of the '--memlimit' budget
+		inline bool		memPressure			() const {
+			return opts.mem_limit && memAccount.total() > stats.sysMemAvail / 1000 * opts.mem_pressure;
+		}
+		// stage changes also refresh the counters, as conflicts may be far apart
+		inline void		stage				(const char* name) {
+			telemetry.stage.store(name, std::memory_order_relaxed);
+			if (opts.telemetry_path) publish();
+		}
+		inline void		publish				() {
+			telemetry.conflicts.store(nConflicts, std::memory_order_relaxed);
+			telemetry.props.store(stats.n_props, std::memory_order_relaxed);
+			telemetry.trail.store(trail.size(), std::memory_order_relaxed);
+			telemetry.learnts.store(learnts.size(), std::memory_order_relaxed);
+			telemetry.learntLits.store(inf.nLearntLits, std::memory_order_relaxed);
+			telemetry.arena.store(cm.size(), std::memory_order_relaxed);
+			telemetry.garbage.store(cm.garbage(), std::memory_order_relaxed);
+		}
+		inline bool		canExport			() const { return opts.stats_period && nConflicts >= lrn.stats_conf_max; }
+		inline bool		exporting			() const { return opts.stats_json || opts.stats_csv; }
+		inline bool		canCollect			() const {
+			for (Byte g = 0; g < CM_REGIONS; g++)
+				if (cm.wasteful(g, opts.gc_perc)) return true;
+			return (cm.garbage() || cm.capacity() > cm.size()) && memPressure();
+		}
+		// arena region of a clause by its status and tier
+		inline Byte		tierOf				(const CL_ST& st, const int& lbd, const bool& keep) const {
+			if (!opts.tier_arenas_en || ISORG(st)) return CM_ORG;
+			return (keep || lbd <= opts.lbd_tier2) ? CM_HOT : CM_COLD;
+		}
+		inline Byte		tierOf				(const CLAUSE& c) const { return tierOf(c.status(), c.lbd(), c.keep()); }
 		inline bool		canSubsume			() const {
 			if (!opts.subsume_en) return false;
 			if (nConflicts != lrn.lastreduce || nConflicts < lrn.subsume_conf_max) return false;
@@ -174,6 +215,9 @@ namespace pFROST {
 		inline void		scaleVarAct			() {
 			for (uint32 v = 1; v <= inf.maxVar; v++) activity[v] *= 1e-150;
 			lrn.var_inc *= 1e-150;
+#ifdef VSIDS_DHEAP
+			vsids.refresh();
+#endif
 		}
 		inline void		initQueue			() {
 			if (verbose == 4) PFLOG2(2, "  Initializing VMFQ Queue with %d variables..", inf.maxVar);
@@ -279,19 +323,20 @@ namespace pFROST {
 			assert(ref < NOREF);
 			int sz = c.size();
 			assert(sz > 1);
-			wt[FLIP(c[0])].push(WATCH(ref, sz, c[1]));
-			wt[FLIP(c[1])].push(WATCH(ref, sz, c[0]));
+			WT& table = sz == 2 ? wtBin : wt;
+			table[FLIP(c[0])].push(WATCH(ref, sz, c[1]));
+			table[FLIP(c[1])].push(WATCH(ref, sz, c[0]));
 		}
 		inline void		attachWatch			(const uint32& lit, const uint32& imp, const C_REF& ref, const int& size) {
 			assert(lit != imp);
 			assert(ref < NOREF);
 			assert(size > 1);
-			wt[FLIP(lit)].push(WATCH(ref, size, imp));
+			(size == 2 ? wtBin : wt)[FLIP(lit)].push(WATCH(ref, size, imp));
 		}
 		inline void		detachWatch			(const uint32& lit, const C_REF& ref) {
 			assert(lit > 1);
 			assert(ref < NOREF);
-			WL& ws = wt[lit];
+			WL ws = (cm[ref].binary() ? wtBin : wt)[lit];
 			if (ws.empty()) return;
 			WATCH* i = ws, *end = ws.end();
 			for (WATCH* j = i; j != end; j++) {
@@ -313,12 +358,25 @@ namespace pFROST {
 			sp->value[FLIP(lit)] = 0;
 			trail.push(lit);
 			if (!wt.empty()) {
-				WL& ws = wt[lit];
+				WL bs = wtBin[lit], ws = wt[lit];
+				if (!bs.empty()) {
+#if _WIN32
+					PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &bs[0]);
+#else
+					__builtin_prefetch(&bs[0], 0, 1);
+#endif
+				}
 				if (!ws.empty()) {
+					// lists are contiguous in the slab, so the second
+					// line of a longer list is worth fetching as well
+					const WATCH* w = ws;
+					const bool more = ws.size() * sizeof(WATCH) > CACHELINE;
 #if _WIN32
-					PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, &ws[0]);
+					PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, w);
+					if (more) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, (const char*)w + CACHELINE);
 #else
-					__builtin_prefetch(&ws[0], 0, 1);
+					__builtin_prefetch(w, 0, 1);
+					if (more) __builtin_prefetch((const char*)w + CACHELINE, 0, 1);
 #endif
 				}
 			}
@@ -340,6 +398,52 @@ namespace pFROST {
 			trail.push(lit);
 			PFLNEWLIT(this, 3, NOREF, lit);
 		}
+		// concurrent (root-level) trail: slots beyond the tail are zeroed
+		// so a reader can spin on a claimed slot until it gets published
+		inline void		openTrail			() {
+			static_assert(sizeof(std::atomic<uint32>) == sizeof(uint32), "atomic trail slots must be lock-free words");
+			static_assert(sizeof(std::atomic<uint16>) == 2 * sizeof(LIT_ST), "atomic value pairs must be lock-free words");
+			assert(!DL());
+			assert(trail.capacity() >= inf.maxVar);
+			const uint32 tail = trail.size();
+			tail_s = tail;
+			std::memset(trail + tail, 0, sizeof(uint32) * (trail.capacity() - tail));
+		}
+		inline void		closeTrail			() {
+			const uint32 tail = tail_s;
+			assert(tail <= trail.capacity());
+			inf.maxFrozen += tail - trail.size();
+			trail.reserve(trail.capacity(), tail);
+		}
+		inline uint32	sharedLit			(const uint32& idx) {
+			assert(idx < trail.capacity());
+			const std::atomic<uint32>* slot = reinterpret_cast<std::atomic<uint32>*>(trail + idx);
+			uint32 lit;
+			while (!(lit = slot->load(std::memory_order_acquire))) std::this_thread::yield();
+			return lit;
+		}
+		// returns 1 if 'lit' is assigned by the caller, 0 if it was true
+		// already, and -1 if it was false (conflict)
+		inline int		enqueueShared		(const uint32& lit) {
+			assert(lit > 1);
+			assert(!DL());
+			const uint32 v = ABS(lit);
+			LIT_ST pair[2] = { UNDEFINED, UNDEFINED };
+			uint16 expected, desired;
+			std::memcpy(&expected, pair, sizeof(uint16));
+			pair[SIGN(lit)] = 1, pair[!SIGN(lit)] = 0;
+			std::memcpy(&desired, pair, sizeof(uint16));
+			std::atomic<uint16>* vpair = reinterpret_cast<std::atomic<uint16>*>(sp->value + V2L(v));
+			if (!vpair->compare_exchange_strong(expected, desired, std::memory_order_acq_rel))
+				return expected == desired ? 0 : -1;
+			sp->vstate[v] = FROZEN;
+			sp->locked[v] = 1;
+			sp->level[v] = 0;
+			const uint32 idx = tail_s.fetch_add(1, std::memory_order_relaxed);
+			assert(idx < trail.capacity());
+			reinterpret_cast<std::atomic<uint32>*>(trail + idx)->store(lit, std::memory_order_release);
+			return 1;
+		}
 		inline int		forcedLevel			(const uint32& lit, const C_REF& src) {
 			assert(opts.chrono_en);
 			assert(REASON(src));
@@ -416,7 +520,7 @@ namespace pFROST {
 		void	subsumeLearnt		(const C_REF&);
 		uint32	makeAssign			(const uint32&, const bool& tphase = false);
 		bool	minimize			(const uint32&, const int& depth = 0);
-		void	reduceLearnts		(const bool& sizeonly = false);
+		void	reduceLearnts		(const bool& sizeonly = false, const bool& squeeze = false);
 		void	reduceTop			(const bool&);
 		void	rebuildWT			(const bool&);
 		void	pumpFrozen			();
@@ -454,10 +558,11 @@ namespace pFROST {
 		void	eligibleVMFQ		();
 		void	decide				();
 		void	report				();
+		void	exportStats			(const bool& = false);
 		void	wrapup				();
 		bool	parser				();
 		void	map					(BCNF&);
-		void	map					(WL&);
+		void	map					(const WL&);
 		void	map					(WT&);
 		void	map					(const bool& = false);
 				ParaFROST			(const string&);
@@ -465,12 +570,14 @@ namespace pFROST {
 		//                Simplifier                //
 		//==========================================//
 	protected:
-		uVec1D		PVs;
+		uVec1D		PVs, colorVars, colorEnds;
 		SCNF		scnf;
 		OT			ot;
 		IG			ig;
-		uint32		mu_inc;
-		bool		mapped;
+		SCRATCHES	scratches;
+		uint32		mu_inc, colorIdx, otTail, nextId;
+		std::atomic<uint32>	tail_s;
+		bool		mapped, skipIGR;
 		int			phase, nForced, sigState;
 	public:
 		//============= inline methods ==============//
@@ -481,21 +588,55 @@ namespace pFROST {
 				shrinkSimp();
 		}
 		inline void		initSimp			() {
-			phase = mu_inc = 0, nForced = 0, sigState = AWAKEN_SUCC;
+			phase = mu_inc = colorIdx = otTail = nextId = 0, nForced = 0, sigState = AWAKEN_SUCC;
+			skipIGR = false;
+		}
+		inline SCRATCH&	scratch				() { return scratches[workerPool.getID()]; }
+		inline uint64	resPairs			(const uint32& v) {
+			assert(v);
+			const uint32 p = V2L(v);
+			return uint64(ot[p].size()) * ot[NEG(p)].size();
+		}
+		// run 'job' over all PVs indices and join; with cost scheduling,
+		// the most expensive variables go first, one per claim, and the
+		// cheap tail in chunks of similar cost. Each
+		// worker keeps the ticks its scans charged to 'simpTicks' in its
+		// own slot, summed after the join
+		template<class Function>
+		inline void		forEachPV			(const Function& job) {
+			Vec<int64> ticks(workerPool.count(), 0);
+			auto counted = [&](const uint32& i) {
+				const int64 before = simpTicks;
+				job(i);
+				ticks[workerPool.getID()] += simpTicks - before;
+			};
+			uVec1D order;
+			if (!opts.cost_sched)
+				workerPool.doWorkForEach((uint32)0, PVs.size(), (uint32)1, counted);
+			else {
+				order.resize(PVs.size());
+				Vec<uint64> costs(PVs.size());
+				for (uint32 i = 0; i < PVs.size(); i++) {
+					const uint32 v = PVs[i];
+					order[i] = i;
+					costs[i] = v ? resPairs(v) + ot[V2L(v)].size() + ot[NEG(V2L(v))].size() : 0;
+				}
+				std::stable_sort(order.data(), order.end(), [&](const uint32& a, const uint32& b) { return costs[a] > costs[b]; });
+				Vec<uint64> acc(PVs.size() + 1);
+				acc[0] = 0;
+				for (uint32 k = 0; k < PVs.size(); k++) acc[k + 1] = acc[k] + costs[order[k]];
+				workerPool.doWorkGuided((uint32)0, PVs.size(), acc.data(), [&](uint32 k) { counted(order[k]); });
+			}
+			workerPool.join();
+			for (uint32 w = 0; w < ticks.size(); w++)
+				stats.n_simpticks += ticks[w];
 		}
 		inline bool		verifyLCVE			() {
 			for (uint32 i = 0; i < PVs.size(); i++)
 				if (sp->frozen[PVs[i]]) return false;
 			return true;
 		}
-		inline void		filterPVs			() {
-			uint32 n = 0;
-			for (uint32 i = 0; i < PVs.size(); i++) {
-				uint32 x = PVs[i];
-				if (x) PVs[n++] = x;
-			}
-			PVs.resize(n);
-		}
+		inline void		filterPVs			() { workerPool.compact(PVs, [](const uint32 x) { return x; }); }
 		inline void		countMelted			() {
 			inf.n_del_vars_after = 0;
 			for (uint32 v = 1; v <= inf.maxVar; v++)
@@ -579,8 +720,38 @@ namespace pFROST {
 				inf.n_cls_after,
 				inf.n_lits_after);
 		}
+		inline void		recordReductions	(const char* stage) {
+			REDUCTION r;
+			r.stage = stage;
+			r.sigmification = stats.sigmifications + 1;
+			r.phase = phase;
+			r.varsRemoved = int64(inf.n_del_vars_after) + nForced;
+			r.clsRemoved = int64(inf.nClauses) - inf.n_cls_after;
+			r.litsRemoved = int64(inf.nLiterals) - inf.n_lits_after;
+			r.vars = maxActive(), r.clauses = inf.n_cls_after, r.literals = inf.n_lits_after;
+			statsReport.reduction(r);
+		}
+		// reductions of a phase when the stages are not counted; the clause
+		// figures come from the cleanup, 'melted' carries over between phases
+		inline void		recordPhase			(uint32& melted) {
+			uint32 nowMelted = 0;
+			for (uint32 v = 1; v <= inf.maxVar; v++)
+				if (sp->vstate[v] == MELTED) nowMelted++;
+			REDUCTION r;
+			r.stage = "Phase Reductions";
+			r.sigmification = stats.sigmifications + 1;
+			r.phase = phase;
+			r.varsRemoved = int64(nowMelted) - melted;
+			r.clsRemoved = int64(inf.nClauses) - inf.n_cls_after;
+			r.litsRemoved = int64(inf.nLiterals) - inf.n_lits_after;
+			r.vars = int64(inf.maxVar) - inf.maxFrozen - nowMelted;
+			r.clauses = inf.n_cls_after, r.literals = inf.n_lits_after;
+			statsReport.reduction(r);
+			melted = nowMelted;
+		}
+		inline bool		fitsMem				(const size_t& size) const { return memAccount.total() + int64(size) <= stats.sysMemAvail; }
 		inline bool		checkMem			(const string& _name, const size_t& size) {
-			int64 sysMemCons = sysMemUsed() + size;
+			int64 sysMemCons = memAccount.total() + size;
 			if (sysMemCons > stats.sysMemAvail) { // to catch memout problems before exception does
 				PFLOGW("not enough memory for %s (free: %lld, used: %lld), simp. will terminate", _name.c_str(), stats.sysMemAvail / MBYTE, sysMemCons / MBYTE);
 				return false;
@@ -624,14 +795,20 @@ namespace pFROST {
 		void	shrinkSimp			();
 		void	sigmify				();
 		bool	LCVE				();
+		bool	colorLCVE			();
+		bool	nextColor			();
 		int		prop				(SCNF* = nullptr);
 		void	IGR					();
+		bool	IGTR				();
 		void	CE					();
+		void	orderedCE			();
 		void	BVE					();
 		void	HSE					();
 		void	ERE					();
+		uint32	DCE					();
 		void	BCE					();
 		void	sortOT				(const bool&);
+		void	orderOT				();
 		void	reduceOT			();
 		void	reduceOL			(OL&);
 		void	extract				(const BCNF&);
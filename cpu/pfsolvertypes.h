@@ -31,13 +31,11 @@ namespace pFROST {
 	/*  Global vector types for CNF/occur lists          */
 	/*****************************************************/
 	typedef Vec<C_REF> BCNF;
-	typedef Vec<WATCH, int> WL;
-	typedef Vec<WL> WT;
 	typedef Vec<uint32, int> BOL;
 	typedef Vec<C_REF, int> WOL;
 	typedef Vec<S_REF, int> OL;
 	typedef Vec<OL> OT;
-	typedef Vec<Node> IG;
+	typedef IGRAPH IG;
 	typedef Vec<S_REF, size_t> SCNF;
 	/*****************************************************/
 	/*  Global structures and comparators		         */
@@ -46,7 +44,8 @@ namespace pFROST {
 		int64 lastreduce;
 		int64 bumped, subtried, elim_marked, elim_lastmarked;
 		int64 subsume_conf_max, sigma_conf_max, mdm_conf_max, reduce_conf_max;
-		int64 restarts_conf_max, stable_conf_max, map_conf_max;
+		int64 subsume_ticks, sigma_ticks, simp_ticks_max, timeout_ticks_max, mem_reduce_conf_max;
+		int64 restarts_conf_max, stable_conf_max, map_conf_max, stats_conf_max;
 		int64 rephased[2], rephase_conf_max, rephase_last_max;
 		double var_inc, var_decay;
 		uint32 numMDs, nRefVars;
@@ -64,10 +63,12 @@ namespace pFROST {
 		std::atomic<int64> n_subchecks, n_subcalls;
 		std::atomic<int64> n_allsubsumed, n_allstrengthened, n_learntsubs;
 		std::atomic<int64> n_triedreduns, n_orgreduns, n_lrnreduns;
+		std::atomic<int64> n_erehits, n_eremisses, n_duplicates;
 		std::atomic<int64> n_fuds, n_mds;
 		std::atomic<int64> n_units, n_props, n_forced;
+		std::atomic<int64> n_ticks, n_simpticks, n_subticks;
 		std::atomic<int64> tot_lits, max_lits, n_glues;
-		std::atomic<int64> reuses, reduces, recyclings;
+		std::atomic<int64> reuses, reduces, recyclings, memsqueezes;
 		std::atomic<int64> stab_restarts, ncbt, cbt;
 		std::atomic<int> sigmifications;
 		std::atomic<int> marker, mdm_calls;
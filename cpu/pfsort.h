@@ -20,11 +20,14 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __SORT_
 
 #include "pfkey.h"
+#include "pfworker.h"
 
 namespace pFROST {
 
 #define INSORT_THR 20
 #define RSORT_THR 800
+#define PRSORT_THR 65536
+#define PRSORT_BLOCK 16
 
 	//============================//
 	//  Sorting Functions         //
@@ -165,6 +168,97 @@ namespace pFROST {
 		assert(isSortedRadix(data, end, rank));
 	}
 
+	// LSD radix sort over 'pool': every worker counts the digits of its own
+	// chunk, a digit-major prefix sum over the per-chunk histograms keeps the
+	// sort stable and each chunk is scattered through small per-digit blocks
+	// that are flushed to the output one block (cache line or more) at a time
+	template<class T, class RANK>
+	void radixSort(T* data, T* end, RANK rank, WorkerPool& pool, const size_t& l = 8ULL)
+	{
+		assert(data <= end);
+		size_t n = end - data;
+		const size_t chunks = pool.count();
+		if (n <= PRSORT_THR || chunks <= 1) { radixSort(data, end, rank, l); return; }
+
+		const size_t w = (1ULL << l);
+		const size_t mask = w - 1;
+		const size_t dsize = (sizeof(rank(*data)) << 3);
+		const size_t chunk = (n + chunks - 1) / chunks;
+
+		Vec<size_t, size_t> count(chunks * w);
+		Vec<size_t, size_t> lower(chunks), upper(chunks);
+		Vec<T, size_t> b(n);
+		T* a = data, * c = a;
+
+		for (size_t i = 0; i < dsize; i += l) {
+
+			pool.doWorkForEach((size_t)0, chunks, [&](size_t t) {
+				size_t* tcount = count + t * w;
+				std::memset(tcount, 0, sizeof(size_t) * w);
+				size_t lo = SIZE_MAX, up = 0;
+				T* cend = c + std::min((t + 1) * chunk, n);
+				for (T* p = c + std::min(t * chunk, n); p < cend; p++) {
+					auto s = rank(*p) >> i;
+					lo &= s;
+					up |= s;
+					tcount[s & mask]++;
+				}
+				lower[t] = lo, upper[t] = up;
+			});
+			pool.join();
+
+			size_t lo = SIZE_MAX, up = 0;
+			for (size_t t = 0; t < chunks; t++) lo &= lower[t], up |= upper[t];
+			if (lo == up) break;
+
+			size_t pos = 0;
+			for (size_t j = 0; j < w; j++) {
+				for (size_t t = 0; t < chunks; t++) {
+					size_t& cnt = count[t * w + j];
+					size_t delta = cnt;
+					cnt = pos;
+					pos += delta;
+				}
+			}
+
+			T* d = (c == a) ? b : a;
+
+			pool.doWorkForEach((size_t)0, chunks, [&](size_t t) {
+				size_t* tpos = count + t * w;
+				Vec<T, size_t> block(w * PRSORT_BLOCK);
+				Vec<uint32, size_t> filled(w, 0);
+				T* cend = c + std::min((t + 1) * chunk, n);
+				for (T* p = c + std::min(t * chunk, n); p < cend; p++) {
+					size_t m = (rank(*p) >> i) & mask;
+					uint32& f = filled[m];
+					T* bm = block + m * PRSORT_BLOCK;
+					bm[f++] = *p;
+					if (f == PRSORT_BLOCK) {
+						std::copy(bm, bm + f, d + tpos[m]);
+						tpos[m] += f, f = 0;
+					}
+				}
+				for (size_t m = 0; m < w; m++) {
+					if (!filled[m]) continue;
+					T* bm = block + m * PRSORT_BLOCK;
+					std::copy(bm, bm + filled[m], d + tpos[m]);
+				}
+			});
+			pool.join();
+			c = d;
+		}
+
+		if (c == b) {
+			pool.doWorkForEach((size_t)0, chunks, [&](size_t t) {
+				size_t first = std::min(t * chunk, n), last = std::min(first + chunk, n);
+				std::copy(b + first, b + last, a + first);
+			});
+			pool.join();
+		}
+
+		assert(isSortedRadix(data, end, rank));
+	}
+
 	template<class T, class SZ>
 	void rSort(T* d, const SZ& sz) {
 		assert(d != NULL);
@@ -215,6 +309,13 @@ namespace pFROST {
 		else radixSort(d.data(), d.end(), rank);
 	}
 
+
+	template<class T, class SZ, class CMP, class RANK>
+	void rSort(Vec<T, SZ>& d, CMP cmp, RANK rank, WorkerPool& pool) {
+		if (d.size() <= PRSORT_THR) rSort(d, cmp, rank);
+		else radixSort(d.data(), d.end(), rank, pool);
+	}
+
 }
 
 #endif // __SORT_
\ No newline at end of file
@@ -30,6 +30,7 @@ namespace pFROST {
 	class SP {
 		addr_t		_mem;
 		size_t		_sz, _cap;
+		bool		_paged;
 		template <class T>
 		size_t		calcBytes(const uint32& sz, const uint32& nVecs) {
 			assert(sz); return size_t(sz) * nVecs * sizeof(T);
@@ -44,6 +45,7 @@ namespace pFROST {
 			_mem(NULL)
 			, _sz(size)
 			, _cap(0)
+			, _paged(false)
 			, trailpivot(0)
 			, propagated(0)
 			, simplified(0)
@@ -54,7 +56,8 @@ namespace pFROST {
 			size_t vec8Bytes = calcBytes<C_REF>(size, 1);
 			_cap = vec1Bytes + vec4Bytes + vec8Bytes;
 			assert(_cap);
-			pfalloc(_mem, _cap);
+			pfrealloc(_mem, _paged, 0, _cap, MEM_SP);
+			memAccount.account(MEM_SP, _cap);
 			assert(_mem != NULL);
 			memset(_mem, 0, _cap);
 			// 1-byte arrays
@@ -107,7 +110,7 @@ namespace pFROST {
 		}
 		void		clearBoard() { memset(board, 0, _sz); }
 		void		clearSubsume() { memset(subsume, 0, _sz); }
-		void		destroy() { if (_mem != NULL) std::free(_mem); }
+		void		destroy() { if (_mem != NULL) pffree(_mem, _paged, _cap), memAccount.account(MEM_SP, -int64(_cap)); }
 		~SP() { destroy(); }
 	};
 }
@@ -47,7 +47,9 @@ inline void	ParaFROST::removeSubsumed(CLAUSE& c, const C_REF& cref, CLAUSE* s, c
 	if (c.original() && s->learnt()) {
 		assert(sref < NOREF);
 		assert(inf.nLearntLits);
+		const Byte tier = tierOf(*s);
 		s->set_status(ORIGINAL);
+		cm.promote(*s, tier, CM_ORG);
 		int ssize = s->size();
 		inf.nLiterals += ssize, inf.nLearntLits -= ssize;
 	}
@@ -80,7 +82,8 @@ inline bool ParaFROST::subsumeCheck(CLAUSE* subsuming, uint32& self)
 	return good;
 }
 
-inline CL_ST ParaFROST::subsumeClause(const C_REF& cref, CLAUSE& c, BCNF& shrunken)
+// 'ticks' is charged with the cache lines of the lists and clauses read
+inline CL_ST ParaFROST::subsumeClause(const C_REF& cref, CLAUSE& c, BCNF& shrunken, int64& ticks)
 {
 	assert(cm[cref] == c);
 	assert(!c.deleted());
@@ -97,6 +100,7 @@ inline CL_ST ParaFROST::subsumeClause(const C_REF& cref, CLAUSE& c, BCNF& shrunk
 			assert(sign == 0 || sign == 1);
 			uint32 slit = sign ? FLIP(lit) : lit;
 			BOL& others = bot[slit];
+			ticks += 1 + cacheLines(others.size() * sizeof(uint32));
 			for (uint32* o = others; o != others.end(); o++) {
 				self = 0;
 				uint32 imp = *o;
@@ -116,9 +120,11 @@ inline CL_ST ParaFROST::subsumeClause(const C_REF& cref, CLAUSE& c, BCNF& shrunk
 			}
 			if (s) break;
 			WOL& wol = wot[slit];
+			ticks += 1 + cacheLines(wol.size() * sizeof(C_REF));
 			for (C_REF* i = wol; i != wol.end(); i++) {
 				CLAUSE* d = cm.clause(*i);
-				if (d->deleted()) continue;
+				if (d->deleted()) { ticks++; continue; }
+				ticks += cacheLines(d->capacity());
 				assert(d != &c);
 				assert(d->size() <= c.size());
 				if (subsumeCheck(d, self)) {
@@ -183,13 +189,16 @@ bool ParaFROST::subsumeAll()
 	assert(!satisfied());
 	assert(conflict == NOREF);
 	assert(cnfstate != UNSAT);
-	assert(wt.empty());
-	int64 sub_inc = stats.n_props;
-	if (sub_inc < opts.subsume_min_checks) sub_inc = opts.subsume_min_checks;
-	if (sub_inc > opts.subsume_max_checks) sub_inc = opts.subsume_max_checks;
+	assert(wt.empty() && wtBin.empty());
+	// the budget is a fraction of the search ticks spent since the last call,
+	// charged with the cache lines subsumption reads as BCP does
+	int64 sub_inc = (stats.n_ticks - lrn.subsume_ticks) * opts.subsume_effort / 1000;
+	lrn.subsume_ticks = stats.n_ticks;
+	if (sub_inc < opts.subsume_min_ticks) sub_inc = opts.subsume_min_ticks;
+	if (sub_inc > opts.subsume_max_ticks) sub_inc = opts.subsume_max_ticks;
 	sub_inc = std::max(sub_inc, int64(maxActive()) << 1);
-	PFLOG2(2, " Subsumption trials started with limit %lld", sub_inc);
-	int64 sub_limit = stats.n_subchecks + sub_inc;
+	PFLOG2(2, " Subsumption trials started with a budget of %lld ticks", sub_inc);
+	int64 ticks = 0;
 	// schedule clauses
 	BCNF shrunken;
 	SUBSUME_OCCURS_CMP clause_cmp(subhist);
@@ -200,10 +209,10 @@ bool ParaFROST::subsumeAll()
 	schedule(learnts);
 	if (scheduled.empty()) goto ending;
 	scheduled.shrinkCap();
-	radixSort(scheduled.data(), scheduled.end(), SUBSUME_RANK());
+	radixSort(scheduled.data(), scheduled.end(), SUBSUME_RANK(), workerPool);
 	if (!subleftovers) {
 		for (CSIZE* i = scheduled; i != scheduled.end(); i++) {
-			assert(i->ref < cm.size());
+			assert(cm.check(i->ref));
 			CLAUSE& c = cm[i->ref];
 			if (c.size() > 2) c.markSubsume();
 		}
@@ -213,15 +222,16 @@ bool ParaFROST::subsumeAll()
 	bot.resize(inf.nDualVars);
 	for (CSIZE* i = scheduled; i != scheduled.end(); i++) {
 		if (interrupted()) break;
-		if (stats.n_subchecks >= sub_limit) break;
+		if (ticks >= sub_inc) break;
 		checked++;
 		C_REF r = i->ref;
 		CLAUSE& c = cm[r];
+		ticks += cacheLines(c.capacity());
 		assert(!c.deleted());
 		PFLCLAUSE(4, c, " Subsuming ");
 		if (c.size() > 2 && c.subsume()) {
 			c.initSubsume();
-			CL_ST st = subsumeClause(r, c, shrunken);
+			CL_ST st = subsumeClause(r, c, shrunken, ticks);
 			if (st > 0) { subsumed++; continue; }
 			if (st < 0) strengthened++;
 		}
@@ -256,7 +266,8 @@ bool ParaFROST::subsumeAll()
 		}
 	}
 ending:
-	PFLOG2(2, " Subsumed %lld and strengthened %lld clauses", subsumed, strengthened);
+	stats.n_subticks += ticks;
+	PFLOG2(2, " Subsumed %lld and strengthened %lld clauses using %lld ticks", subsumed, strengthened, ticks);
 	if (scheduled.size() == checked) sp->clearSubsume();
 	for (C_REF* r = shrunken; r != shrunken.end(); r++) markSubsume(cm[*r]);
 	shrunken.clear(true), scheduled.clear(true), subhist.clear(true);
@@ -268,14 +279,16 @@ ending:
 
 void ParaFROST::subsume()
 {
+	PFTRACE("subsume");
 	if (orgs.empty() && learnts.empty()) return;
 	stats.n_subcalls++;
 	backtrack();
 	if (BCP()) { cnfstate = UNSAT; return; }
 	printStats(1, '-', CORANGE0);
-	wt.clear(true);
+	wt.clear(true), wtBin.clear(true);
 	bool success = subsumeAll();
 	wt.resize(inf.nDualVars);
+	wtBin.resize(inf.nDualVars);
 	rebuildWT(opts.priorbins_en);
 	filter(learnts, orgs, ORIGINAL);
 	assert(sp->propagated == trail.size());
@@ -0,0 +1,109 @@
+/***********************************************************************[pftelemetry.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfcontrol.h"
+#include "pfreport.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace pFROST {
+
+	// Progress gauges published by the solver and rewritten by a
+	// background thread to a file in Prometheus text format every
+	// 'period' seconds; the solver only stores into relaxed atomics
+	class TELEMETRY {
+		typedef std::chrono::steady_clock CLOCK;
+		std::thread				_thread;
+		std::mutex				_mutex;
+		std::condition_variable	_cv;
+		std::string				_path;
+		CLOCK::time_point		_last;
+		int64					_lastConflicts, _lastProps;
+		int						_period;
+		bool					_stop;
+
+		inline static void		metric		(std::string& out, const char* name, const char* type, const char* help, const double& val) {
+			char buf[64];
+			snprintf(buf, sizeof(buf), "%.15g", val);
+			out += "# HELP parafrost_" + std::string(name) + " " + help + "\n";
+			out += "# TYPE parafrost_" + std::string(name) + " " + type + "\n";
+			out += "parafrost_" + std::string(name) + " " + buf + "\n";
+		}
+		inline void				write		() {
+			const CLOCK::time_point now = CLOCK::now();
+			const double secs = std::chrono::duration<double>(now - _last).count();
+			const int64 confs = conflicts.load(std::memory_order_relaxed);
+			const int64 ps = props.load(std::memory_order_relaxed);
+			const int64 size = arena.load(std::memory_order_relaxed);
+			std::string out;
+			metric(out, "conflicts_total", "counter", "Conflicts since the search started.", double(confs));
+			metric(out, "propagations_total", "counter", "Propagated literals since the search started.", double(ps));
+			metric(out, "conflicts_per_second", "gauge", "Conflict rate since the previous snapshot.", secs > 0 ? (confs - _lastConflicts) / secs : 0);
+			metric(out, "propagations_per_second", "gauge", "Propagation rate since the previous snapshot.", secs > 0 ? (ps - _lastProps) / secs : 0);
+			metric(out, "trail_size", "gauge", "Assigned literals on the trail.", double(trail.load(std::memory_order_relaxed)));
+			metric(out, "learnt_clauses", "gauge", "Learnt clauses in the database.", double(learnts.load(std::memory_order_relaxed)));
+			metric(out, "learnt_literals", "gauge", "Literals in learnt clauses.", double(learntLits.load(std::memory_order_relaxed)));
+			metric(out, "garbage_ratio", "gauge", "Garbage fraction of the clause arena.", size ? double(garbage.load(std::memory_order_relaxed)) / size : 0);
+			metric(out, "memory_used_bytes", "gauge", "Resident memory of the solver process.", double(sysMemUsed()));
+			metric(out, "memory_tracked_bytes", "gauge", "Memory held by the solver's tracked allocations.", double(memAccount.total()));
+			out += "# HELP parafrost_stage Current solver stage.\n# TYPE parafrost_stage gauge\n";
+			out += "parafrost_stage{stage=\"" + std::string(stage.load(std::memory_order_relaxed)) + "\"} 1\n";
+			replaceFile(_path, out);
+			_last = now, _lastConflicts = confs, _lastProps = ps;
+		}
+		inline void				run			() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			while (!_cv.wait_for(lock, std::chrono::seconds(_period), [this] { return _stop; }))
+				write();
+		}
+
+	public:
+		std::atomic<int64>		conflicts, props, trail, learnts, learntLits, arena, garbage;
+		std::atomic<const char*> stage;
+
+		inline					TELEMETRY	() :
+			_lastConflicts(0), _lastProps(0), _period(0), _stop(false),
+			conflicts(0), props(0), trail(0), learnts(0), learntLits(0), arena(0), garbage(0), stage("search") {}
+		inline					~TELEMETRY	() { stop(); }
+		inline void				start		(const char* path, const int& period) {
+			assert(!_thread.joinable());
+			assert(period > 0);
+			_path = path, _period = period, _stop = false;
+			_last = CLOCK::now();
+			_thread = std::thread(&TELEMETRY::run, this);
+		}
+		// stop the writer and leave a last snapshot behind
+		inline void				stop		() {
+			if (!_thread.joinable()) return;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stop = true;
+			}
+			_cv.notify_all();
+			_thread.join();
+			stage = "done";
+			write();
+		}
+	};
+
+}
@@ -0,0 +1,122 @@
+/***********************************************************************[pftrace.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfreport.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace pFROST {
+
+	// Timeline of begin/end events dumped in Chrome trace format. Every
+	// thread owns a ring buffer that only it writes to, so recording
+	// takes no locks; a thread registers its ring on its first event.
+	// When tracing is off, recording is a single relaxed load
+	class TRACER {
+		typedef std::chrono::steady_clock CLOCK;
+		struct EVENT {
+			int64		ts;
+			const char*	name;
+			char		ph;
+		};
+		struct RING {
+			std::vector<EVENT>	events;
+			uint64				head;
+			int					tid;
+		};
+		std::vector<std::unique_ptr<RING>>	_rings;
+		std::mutex							_mutex;
+		std::atomic<bool>					_on;
+		CLOCK::time_point					_start;
+		size_t								_mask;
+		inline static thread_local RING*	_ring = NULL;
+
+		inline RING*			ring		() {
+			if (_ring == NULL) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				RING* r = new RING;
+				r->events.resize(_mask + 1);
+				r->head = 0;
+				r->tid = (int)_rings.size();
+				_rings.emplace_back(r);
+				_ring = r;
+			}
+			return _ring;
+		}
+		inline void				record		(const char* name, const char& ph) {
+			RING* r = ring();
+			EVENT& e = r->events[r->head++ & _mask];
+			e.ts = std::chrono::duration_cast<std::chrono::nanoseconds>(CLOCK::now() - _start).count();
+			e.name = name, e.ph = ph;
+		}
+
+	public:
+		inline					TRACER		() : _on(false), _mask(0) {}
+		inline bool				enabled		() const { return _on.load(std::memory_order_relaxed); }
+		// enable tracing with 'capacity' (rounded to a power of two) events
+		// kept per thread; the calling thread becomes thread 0
+		inline void				start		(const size_t& capacity) {
+			size_t cap = 1;
+			while (cap < capacity) cap <<= 1;
+			_mask = cap - 1;
+			_start = CLOCK::now();
+			ring();
+			_on.store(true, std::memory_order_release);
+		}
+		inline void				begin		(const char* name) { if (enabled()) record(name, 'B'); }
+		inline void				end			(const char* name) { if (enabled()) record(name, 'E'); }
+		// must be called when no other thread is recording
+		inline bool				dump		(const std::string& path) {
+			_on.store(false, std::memory_order_release);
+			std::string out = "{\"traceEvents\":[";
+			bool first = true;
+			char buf[160];
+			for (const std::unique_ptr<RING>& r : _rings) {
+				snprintf(buf, sizeof(buf), "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+					first ? "" : ",", r->tid, r->tid ? "worker" : "main", r->tid);
+				out += buf, first = false;
+				const uint64 cap = _mask + 1, from = r->head > cap ? r->head - cap : 0;
+				for (uint64 i = from; i < r->head; i++) {
+					const EVENT& e = r->events[i & _mask];
+					snprintf(buf, sizeof(buf), ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%lld.%03lld}",
+						e.name, e.ph, r->tid, e.ts / 1000, e.ts % 1000);
+					out += buf;
+				}
+			}
+			out += "\n]}\n";
+			return replaceFile(path, out);
+		}
+	};
+
+	inline TRACER tracer;
+
+	// begin/end pair around the enclosing scope
+	struct TRACE_SCOPE {
+		const char* name;
+		const bool on;
+		inline TRACE_SCOPE(const char* name) : name(name), on(tracer.enabled()) { if (on) tracer.begin(name); }
+		inline ~TRACE_SCOPE() { if (on) tracer.end(name); }
+	};
+
+#define PFTRACE(NAME) TRACE_SCOPE _trace_scope_(NAME)
+
+}
@@ -0,0 +1,146 @@
+/***********************************************************************[pftred.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "pfsimp.h"
+#include "pftred.h"
+
+using namespace pFROST;
+
+// Remove redundant binary edges (and detect failed literals) via
+// bounded reachability queries pruned by interval labels instead of
+// materializing descendant sets; returns false if the caller should
+// fall back to the descendants-based exploration
+bool ParaFROST::IGTR()
+{
+	PFTRACE("IGTR");
+	assert(opts.igr_labels > 0);
+	const uint32 nodes = inf.nDualVars;
+	const uint32 effort = opts.igr_effort;
+	const size_t budget = size_t(opts.igr_label_mem) * MBYTE;
+	const size_t qbytes = TRQUERY::bytes(effort) * workerPool.count();
+	if (nodes <= 2) return false;
+	int k = opts.igr_labels;
+	while (k && TRED::bytes(nodes, k) + qbytes > budget) k--;
+	if (!k || memAccount.total() + int64(TRED::bytes(nodes, k) + qbytes) > stats.sysMemAvail) {
+		PFLOG2(5, "  IG of %d nodes is too large to label, falling back to descendant sets", nodes);
+		return false;
+	}
+	if (opts.profile_simp) timer.pstart();
+	TRED tred(nodes, k);
+	bool acyclic = tred.build(ig, workerPool, opts.seed);
+	if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[6] += timer.pcpuTime();
+	if (!acyclic) {
+		PFLOG2(5, "  IG is cyclic, falling back to descendant sets");
+		return false;
+	}
+	if (opts.profile_simp) timer.pstart();
+	std::vector<TRQUERY> queries(workerPool.count());
+	std::vector<uVec1D> failed(workerPool.count());
+	// deterministic: searches see the graph as it was before the pass
+	std::vector<SCNF> redundant(opts.deterministic ? workerPool.count() : 0);
+	for (uint32 i = 0; i < queries.size(); i++) queries[i].init(effort);
+	std::atomic<uint32> removed = 0;
+	if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[7] += timer.pcpuTime(), timer.pstart();
+
+	workerPool.doWorkForEach((uint32)2, nodes, [&](uint32 lit) {
+		if (ig[lit].isReduced()) return;
+		const EdgeRange cs = ig.children(lit);
+		const uint32 flipLit = FLIP(lit);
+		const bool fle = opts.fle_en && tred.mayReach(lit, flipLit);
+		uint32 live = 0, minRank = fle ? tred.rank(flipLit) : UINT32_MAX;
+		for (uint32 i = 0; i < cs.size(); i++) {
+			if (cs[i].second->deleted()) continue;
+			const uint32 r = tred.rank(cs[i].first);
+			if (r < minRank) minRank = r;
+			live++;
+		}
+		if (!live || (live < 2 && !fle)) return;
+		const int ti = workerPool.getID();
+		assert(ti >= 0);
+		TRQUERY& query = queries[ti];
+		uVec1D& stack = query.stack();
+		query.reset();
+		// seed the search with the grandchildren, so any child reached
+		// has another path from 'lit' making its edge redundant
+		for (uint32 i = 0; i < cs.size(); i++) {
+			if (cs[i].second->deleted()) continue;
+			const EdgeRange gcs = ig.children(cs[i].first);
+			for (uint32 j = 0; j < gcs.size(); j++)
+				if (!gcs[j].second->deleted()) query.push(gcs[j].first);
+		}
+		bool isFailed = false;
+		while (stack.size() && !query.exhausted()) {
+			const uint32 w = stack.back();
+			stack.pop();
+			if (!query.visit(w)) continue;
+			if (fle && w == flipLit) { isFailed = true; break; }
+			const uint32 r = tred.rank(w);
+			if (r < minRank) continue; // cannot reach any child
+			// check if 'w' is a child (rows are sorted by literal)
+			uint32 lo = 0, hi = cs.size();
+			while (lo < hi) {
+				const uint32 mid = (lo + hi) >> 1;
+				if (cs[mid].first < w) lo = mid + 1;
+				else hi = mid;
+			}
+			for (uint32 i = lo; i < cs.size() && cs[i].first == w; i++) {
+				if (cs[i].second->deleted()) continue;
+				if (redundant.empty()) cs[i].second->markDeleted(), removed++;
+				else redundant[ti].push(cs[i].second);
+			}
+			if (r == minRank) continue;
+			if (live <= TRED_LABEL_TARGETS) {
+				bool reach = fle && tred.mayReach(w, flipLit);
+				for (uint32 i = 0; i < cs.size() && !reach; i++)
+					reach = !cs[i].second->deleted() && tred.mayReach(w, cs[i].first);
+				if (!reach) continue;
+			}
+			const EdgeRange ws = ig.children(w);
+			for (uint32 i = 0; i < ws.size(); i++) {
+				if (ws[i].second->deleted()) continue;
+				const uint32 v = ws[i].first;
+				if (tred.rank(v) >= minRank) query.push(v);
+			}
+		}
+		if (isFailed) failed[ti].push(flipLit);
+	});
+	workerPool.join();
+	for (uint32 i = 0; i < redundant.size(); i++) {
+		for (size_t j = 0; j < redundant[i].size(); j++)
+			if (!redundant[i][j]->deleted()) redundant[i][j]->markDeleted(), removed++;
+	}
+	if (opts.deterministic) {
+		for (uint32 i = 1; i < failed.size(); i++) {
+			for (uint32 j = 0; j < failed[i].size(); j++) failed[0].push(failed[i][j]);
+			failed[i].clear();
+		}
+		std::sort(failed[0].data(), failed[0].end());
+	}
+
+	uint32 nFailed = 0;
+	for (uint32 i = 0; i < failed.size() && cnfstate == UNSOLVED; i++) {
+		for (uint32 j = 0; j < failed[i].size(); j++) {
+			const uint32 unit = failed[i][j];
+			if (unassigned(unit)) enqueueOrg(unit), nFailed++;
+			else if (isFalse(unit)) { cnfstate = UNSAT; break; }
+		}
+	}
+	PFLOG2(5, "  removed %d redundant edges and %d failed literals using %d interval labels", (uint32)removed, nFailed, k);
+	if (opts.profile_simp) timer.pstop(), timer.igr += timer.pcpuTime(), timer.igr_part[8] += timer.pcpuTime();
+	return true;
+}
@@ -0,0 +1,169 @@
+/***********************************************************************[pftred.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#pragma once
+
+#include "pfnode.h"
+#include "pfrandom.h"
+#include "pfworker.h"
+
+namespace pFROST {
+
+	#define TRED_LABEL_TARGETS 16
+
+	// Interval label of a node in one DFS traversal of the implication graph,
+	// where 'rank' is the post-order number and 'low' is the minimum rank
+	// found below the node. If 'v' is reachable from 'u', then the interval
+	// of 'v' is nested in the interval of 'u' for every traversal
+	struct Interval {
+		uint32 low, rank;
+		inline bool contains(const Interval& other) const { return low <= other.low && other.rank <= rank; }
+	};
+
+	// Bounded per-worker workspace for reachability queries
+	class TRQUERY {
+		uVec1D	_keys, _stamps;
+		uVec1D	_stack;
+		uint32	_mask, _stamp, _used, _limit;
+
+		inline static uint32 slots	(const uint32& limit) {
+			uint32 cap = 1;
+			while (cap < (limit << 1)) cap <<= 1;
+			return cap;
+		}
+
+	public:
+		inline			TRQUERY		() : _mask(0), _stamp(0), _used(0), _limit(0) {}
+		inline void		init		(const uint32& limit) {
+			const uint32 cap = slots(limit);
+			_keys.resize(cap, 0), _stamps.resize(cap, 0), _stack.reserve(limit);
+			_mask = cap - 1, _limit = limit, _stamp = 0;
+		}
+		inline void		reset		() {
+			_used = 0, _stack.clear();
+			if (!++_stamp) { _stamps.init(0, _stamps.size(), 0); _stamp = 1; }
+		}
+		// returns false if 'lit' was visited before in this query
+		inline bool		visit		(const uint32& lit) {
+			uint32 h = (lit * 2654435761u) & _mask;
+			while (_stamps[h] == _stamp) {
+				if (_keys[h] == lit) return false;
+				h = (h + 1) & _mask;
+			}
+			_stamps[h] = _stamp, _keys[h] = lit, _used++;
+			return true;
+		}
+		// a full stack ends the query like the visit limit does
+		inline void		push		(const uint32& lit) {
+			if (_stack.size() < _limit) _stack.push(lit);
+			else _used = _limit;
+		}
+		inline bool		exhausted	() const { return _used >= _limit; }
+		inline uVec1D&	stack		() { return _stack; }
+		inline static size_t bytes	(const uint32& limit) { return (size_t(slots(limit)) * 2 + limit) * sizeof(uint32); }
+	};
+
+	// Transitive reduction of the (acyclic) implication graph using
+	// 'k' interval labels per node to prune the reachability queries
+	class TRED {
+		Interval*	_labels;
+		uint32		_n;
+		int			_k;
+
+		inline Interval&		label		(const uint32& lit, const int& d) { return _labels[size_t(lit) * _k + d]; }
+
+		// label all nodes via an iterative DFS; the first traversal follows
+		// the natural order, others rotate roots and children randomly
+		inline bool				traverse	(const IG& ig, const int& d, const uint64& seed) {
+			const uint32 ON_STACK = UINT32_MAX;
+			RANDOM random(seed + d);
+			Vec<std::pair<uint32, uint32>> stack;
+			uint32 counter = 0;
+			const uint32 rootOff = d ? random.generate() % (_n - 2) : 0;
+			for (uint32 r = 0; r < _n - 2; r++) {
+				const uint32 root = 2 + ((r + rootOff) % (_n - 2));
+				if (label(root, d).rank) continue;
+				label(root, d).low = ON_STACK;
+				stack.push(std::make_pair(root, 0));
+				while (stack.size()) {
+					const uint32 u = stack.back().first;
+					const EdgeRange cs = ig.children(u);
+					const uint32 deg = cs.size();
+					uint32& pos = stack.back().second;
+					uint32 v = 0;
+					if (pos < deg) {
+						const uint32 off = (d && deg) ? (u ^ rootOff) % deg : 0;
+						while (pos < deg && !v) {
+							const Edge& e = cs[(pos + off) % deg];
+							pos++;
+							if (!e.second->deleted()) v = e.first;
+						}
+					}
+					if (v) {
+						Interval& lv = label(v, d);
+						if (!lv.rank) {
+							if (lv.low == ON_STACK) return false; // cycle
+							lv.low = ON_STACK;
+							stack.push(std::make_pair(v, 0));
+						}
+						continue;
+					}
+					stack.pop();
+					Interval& lu = label(u, d);
+					lu.rank = ++counter, lu.low = lu.rank;
+					for (uint32 i = 0; i < deg; i++) {
+						if (cs[i].second->deleted()) continue;
+						const Interval& lc = label(cs[i].first, d);
+						if (lc.low < lu.low) lu.low = lc.low;
+					}
+				}
+			}
+			return true;
+		}
+
+	public:
+		inline					TRED		(const uint32& nodes, const int& k) : _labels(NULL), _n(nodes), _k(k) {
+			assert(_n > 2 && _k > 0);
+			pfalloc(_labels, sizeof(Interval) * _n * _k);
+			std::memset(_labels, 0, sizeof(Interval) * _n * _k);
+		}
+		inline					~TRED		() { if (_labels != NULL) std::free(_labels), _labels = NULL; }
+		inline const Interval&	label		(const uint32& lit, const int& d) const { return _labels[size_t(lit) * _k + d]; }
+		inline uint32			rank		(const uint32& lit) const { return label(lit, 0).rank; }
+		inline bool				mayReach	(const uint32& from, const uint32& to) const {
+			if (rank(from) <= rank(to)) return false;
+			for (int d = 0; d < _k; d++)
+				if (!label(from, d).contains(label(to, d))) return false;
+			return true;
+		}
+		// compute all labels in parallel (one traversal per worker),
+		// returns false if the graph is cyclic
+		inline bool				build		(const IG& ig, WorkerPool& pool, const uint64& seed) {
+			std::atomic<bool> acyclic = true;
+			pool.doWorkForEach(0, _k, 1, [&](int d) {
+				if (!traverse(ig, d, seed)) acyclic = false;
+			});
+			pool.join();
+			return acyclic;
+		}
+		inline static size_t	bytes		(const uint32& nodes, const int& k) {
+			return size_t(nodes) * k * sizeof(Interval) + size_t(nodes) * k * 2 * sizeof(uint32);
+		}
+	};
+
+}
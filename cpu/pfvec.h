@@ -35,11 +35,25 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace pFROST {
 
+	template<class T, class S> class Vec;
+
+	// nested vectors are accounted to the category of their parent
+	template<class T>
+	inline void inheritTag(T&, const Byte&) {}
+	template<class T, class S>
+	inline void inheritTag(Vec<T, S>& v, const Byte& cat) { v.tag(cat); }
+
 	template<class T, class S = uint32>
 	class Vec {
 		mutable std::shared_mutex _m;
 		T* _mem;
 		S sz, cap, maxCap;
+		Byte _cat;
+		bool _paged;
+
+		__forceinline void account(const S& oldCap) const {
+			if (cap != oldCap) memAccount.account(_cat, (int64(cap) - int64(oldCap)) * int64(sizeof(T)));
+		}
 
 		bool check(const S& idx) const {
 			if (idx >= sz) {
@@ -51,11 +65,11 @@ namespace pFROST {
 		}
 	public:
 		__forceinline			~Vec		() { clear(true); }
-		__forceinline			Vec			() { init(); }
-		__forceinline			Vec			(const Vec<T, S>& orig) { init(); copyFrom(orig); }
-		__forceinline explicit	Vec			(const S& size) { init(); resize(size); }
-		__forceinline			Vec			(const S& size, const T& val) { init(); resize(size, val); }
-		__forceinline			Vec			(const std::initializer_list<T>& src) { init(); copyFrom(src); }
+		__forceinline			Vec			() : _cat(MEM_OTHER) { init(); }
+		__forceinline			Vec			(const Vec<T, S>& orig) : _cat(orig._cat) { init(); copyFrom(orig); }
+		__forceinline explicit	Vec			(const S& size) : _cat(MEM_OTHER) { init(); resize(size); }
+		__forceinline			Vec			(const S& size, const T& val) : _cat(MEM_OTHER) { init(); resize(size, val); }
+		__forceinline			Vec			(const std::initializer_list<T>& src) : _cat(MEM_OTHER) { init(); copyFrom(src); }
 		__forceinline Vec<T>&	operator=	(Vec<T>& rhs) { return *this; }
 		__forceinline const T&	operator[]	(const S& index) const { assert(check(index)); return _mem[index]; }
 		__forceinline T&		operator[]	(const S& index) { assert(check(index)); return _mem[index]; }
@@ -75,9 +89,9 @@ namespace pFROST {
 		__forceinline void		unlock		() const { _m.unlock(); }
 		__forceinline void		lockRead	() const { _m.lock_shared(); }
 		__forceinline void		unlockRead	() const { _m.unlock_shared(); }
-		__forceinline void		init		() { maxCap = std::numeric_limits<S>::max(), _mem = NULL, sz = 0, cap = 0; }
-		__forceinline			Vec			(Vec<T, S>&& orig) { 
-			maxCap = std::numeric_limits<S>::max(), _mem = orig._mem, sz = orig.sz, cap = orig.cap; orig.init();
+		__forceinline void		init		() { maxCap = std::numeric_limits<S>::max(), _mem = NULL, sz = 0, cap = 0, _paged = false; }
+		__forceinline			Vec			(Vec<T, S>&& orig) : _cat(orig._cat) {
+			maxCap = std::numeric_limits<S>::max(), _mem = orig._mem, sz = orig.sz, cap = orig.cap, _paged = orig._paged; orig.init();
 		}
 		__forceinline void		init		(const S& off, const S& n, const T& val) {
 			if (!val && !off) { std::memset(_mem, 0, n * sizeof(T)); }
@@ -105,7 +119,7 @@ namespace pFROST {
 		__forceinline void		expand		(const S& size) {
 			if (sz >= size) return;
 			reserve(size);
-			for (S i = sz; i < size; i++) new (&_mem[i]) T();
+			for (S i = sz; i < size; i++) new (&_mem[i]) T(), inheritTag(_mem[i], _cat);
 			sz = size;
 		}
 		__forceinline void		expand		(const S& size, const T& val) {
@@ -116,15 +130,36 @@ namespace pFROST {
 		}
 		__forceinline void		reserve		(const S& min_cap) {
 			if (cap >= min_cap) return;
+			const S oldCap = cap;
 			if (cap > (maxCap - cap)) cap = min_cap;
 			else { cap <<= 1; if (cap < min_cap) cap = min_cap; }
-			pfalloc(_mem, sizeof(T) * cap);
+			pfrealloc(_mem, _paged, sizeof(T) * oldCap, sizeof(T) * cap, _cat);
+			account(oldCap);
+		}
+		__forceinline void		swap		(Vec<T, S>& other) {
+			if (_cat != other._cat) {
+				const int64 delta = (int64(other.cap) - int64(cap)) * int64(sizeof(T));
+				memAccount.account(_cat, delta), memAccount.account(other._cat, -delta);
+			}
+			std::swap(_mem, other._mem), std::swap(sz, other.sz), std::swap(cap, other.cap), std::swap(_paged, other._paged);
 		}
 		__forceinline void		shrinkCap	() {
 			if (!sz) { clear(true); return; }
-			pfshrinkAlloc(_mem, sizeof(T) * sz);
+			const S oldCap = cap;
+			if (_paged) pfrealloc(_mem, _paged, sizeof(T) * oldCap, sizeof(T) * sz, _cat);
+			else pfshrinkAlloc(_mem, sizeof(T) * sz);
 			cap = sz;
+			account(oldCap);
+		}
+		// account the buffer (and nested ones created later) to 'cat'
+		__forceinline void		tag			(const Byte& cat) {
+			assert(cat < MEM_CATS);
+			if (cat == _cat) return;
+			const int64 bytes = int64(cap) * int64(sizeof(T));
+			if (bytes) memAccount.account(_cat, -bytes), memAccount.account(cat, bytes);
+			_cat = cat;
 		}
+		__forceinline Byte		category	() const { return _cat; }
 		__forceinline void		copyFrom	(const std::initializer_list<T>& copy) {
 			clear(true);
 			reserve((S)copy.size());
@@ -143,7 +178,7 @@ namespace pFROST {
 			if (_mem != NULL) {
 				for (S i = 0; i < sz; i++) _mem[i].~T();
 				sz = 0;
-				if (_free) { std::free(_mem); _mem = NULL; cap = 0; }
+				if (_free) { pffree(_mem, _paged, sizeof(T) * cap); memAccount.account(_cat, -int64(cap) * int64(sizeof(T))); cap = 0; }
 			}
 		}
 		__forceinline void		unionize	(const Vec<T, S>& rhs) { unionize(rhs, std::less<T>()); }
@@ -165,6 +200,26 @@ namespace pFROST {
 				resize(k);
 			}
 		}
+		// same as 'unionize' but merges into 'tmp' and swaps buffers,
+		// so a reused 'tmp' saves the allocation per call
+		template<class Comparator>
+		__forceinline void		unionize	(const Vec<T, S>& rhs, Vec<T, S>& tmp, Comparator less) {
+			if (empty()) copyFrom(rhs);
+			else if (!rhs.empty()) {
+				tmp.reserve(sz + rhs.size());
+				S i = 0, j = 0, k = 0;
+				while (i < sz && j < rhs.size()) {
+					if (less(_mem[i], rhs[j])) tmp._mem[k++] = _mem[i++];
+					else if (less(rhs[j], _mem[i])) tmp._mem[k++] = rhs[j++];
+					else { tmp._mem[k++] = _mem[i++]; j++; }
+				}
+				while (i < sz) tmp._mem[k++] = _mem[i++];
+				while (j < rhs.size()) tmp._mem[k++] = rhs[j++];
+				tmp.sz = k;
+				swap(tmp);
+				tmp.clear();
+			}
+		}
 		__forceinline void		intersect	(const Vec<T, S>& rhs) { intersect(rhs, std::less<T>()); }
 		template<class Comparator>
 		__forceinline void		intersect	(const Vec<T, S>& rhs, Comparator less) {
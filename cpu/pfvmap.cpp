@@ -28,7 +28,7 @@ void ParaFROST::map(BCNF& cnf) {
 	}
 }
 
-void ParaFROST::map(WL& ws) {
+void ParaFROST::map(const WL& ws) {
 	if (ws.empty()) return;
 	for (WATCH* w = ws; w != ws.end(); w++)
 		w->imp = vmap.mapLit(w->imp);
@@ -43,8 +43,8 @@ void ParaFROST::map(WT& wt) {
 			uint32 p = V2L(v), n = NEG(p);
 			uint32 mpos = V2L(mVar), mneg = NEG(mpos);
 			if (mVar != v) { // map watch lists
-				wt[mpos].copyFrom(wt[p]);
-				wt[mneg].copyFrom(wt[n]);
+				wt.move(mpos, p);
+				wt.move(mneg, n);
 			}
 			map(wt[mpos]), map(wt[mneg]); // then map watch imps
 		}
@@ -60,13 +60,13 @@ void ParaFROST::map(const bool& sigmified)
 	assert(!DL());
 	assert(trail.size() == sp->propagated);
 	stats.mappings++;
-	int64 memBefore = sysMemUsed();
+	int64 memBefore = memAccount.total();
 	vmap.initiate(sp);
 	// map original literals with current values
 	vmap.mapOrgs(model.lits);
 	vmap.mapShrinkVars(vorg);
 	// map clauses and watch tables
-	if (!sigmified) map(orgs), map(learnts), map(wt);
+	if (!sigmified) map(orgs), map(learnts), map(wt), map(wtBin);
 	else mapped = true, newBeginning(), mapped = false;
 	// map trail, queue and heap
 	vmap.mapShrinkLits(trail);
@@ -100,7 +100,7 @@ void ParaFROST::map(const bool& sigmified)
 	stats.marker = 0;
 	memset(sp->marks, UNDEFINED, vmap.size());
 	PFLOG2(2, " Variable mapping compressed %d to %d, saving %.2f KB of memory",
-		inf.maxVar, vmap.numVars(), double(abs(memBefore - sysMemUsed())) / KBYTE);
+		inf.maxVar, vmap.numVars(), double(abs(memBefore - memAccount.total())) / KBYTE);
 	inf.maxVar = vmap.numVars();
 	inf.nDualVars = V2L(inf.maxVar + 1);
 	inf.maxFrozen = inf.maxMelted = 0;
@@ -26,7 +26,7 @@ void ParaFROST::attachBins(BCNF& src)
     C_REF* end = src.end();
     for (C_REF* i = src; i != end; i++) {
         C_REF r = *i;
-        assert(r < cm.size());
+        assert(cm.check(r));
         CLAUSE& c = cm[r];
         if (c.deleted() || !c.binary()) continue;
         attachWatch(r, c);
@@ -39,7 +39,7 @@ void ParaFROST::attachNonBins(BCNF& src)
     C_REF* end = src.end();
     for (C_REF* i = src; i != end; i++) {
         C_REF r = *i;
-        assert(r < cm.size());
+        assert(cm.check(r));
         CLAUSE& c = cm[r];
         if (c.deleted() || c.binary()) continue;
         attachWatch(r, c);
@@ -52,7 +52,7 @@ void ParaFROST::attachClauses(BCNF& src)
     C_REF* end = src.end();
     for (C_REF* i = src; i != end; i++) {
         C_REF r = *i;
-        assert(r < cm.size());
+        assert(cm.check(r));
         CLAUSE& c = cm[r];
         if (c.deleted()) continue;
         attachWatch(r, c);
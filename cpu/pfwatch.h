@@ -25,6 +25,19 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace pFROST {
 
+#ifdef COMPACT_REFS
+	// 8 bytes: the binary flag shares a word with the blocking literal
+	struct WATCH {
+		C_REF	ref;
+		uint32	imp : 31, bin : 1;
+
+		inline		WATCH	() { ref = NOREF, imp = 0, bin = 0; }
+		inline		WATCH	(const C_REF& cref, const int& sz, const uint32& lit) { ref = cref, imp = lit, bin = sz == 2; }
+		inline bool binary	() const { return bin; }
+		inline void resize	(const int& sz) { bin = sz == 2; }
+	};
+	static_assert(sizeof(WATCH) == 8, "compact watch is not 8 bytes");
+#else
 	struct WATCH {
 		C_REF	ref;
 		uint32	imp;
@@ -33,7 +46,146 @@ namespace pFROST {
 		inline		WATCH	() { ref = NOREF, size = 0, imp = 0; }
 		inline		WATCH	(const C_REF& cref, const int& sz, const uint32& lit) { ref = cref, size = sz, imp = lit; }
 		inline bool binary	() const { return size == 2; }
+		inline void resize	(const int& sz) { size = sz; }
+	};
+#endif
+
+#define WL_INIT_CAP 4
+
+	// place of one watch list in the slab
+	struct WSPAN {
+		size_t	off;
+		int		sz, cap;
+	};
+
+	class WT;
+	/*****************************************************/
+	/*  Usage: view of one watch list in the slab        */
+	/*  Dependency:  WT                                  */
+	/*****************************************************/
+	class WL {
+		WT&			_wt;
+		uint32		_lit;
+	public:
+		inline				WL			(WT& wt, const uint32& lit) : _wt(wt), _lit(lit) {}
+		inline	operator	WATCH*		() const;
+		inline	WATCH*		end			() const;
+		inline	WATCH&		operator[]	(const int& i) const;
+		inline	int			size		() const;
+		inline	bool		empty		() const { return !size(); }
+		inline	void		push		(const WATCH& w) const;
+		inline	void		resize		(const int& n) const;
+		inline	void		clear		(const bool& _free = false) const;
 	};
+	/*****************************************************/
+	/*  Usage: watch lists of all literals in one slab   */
+	/*  Dependency:  WATCH, WSPAN                        */
+	/*****************************************************/
+	// A list that outgrows its capacity is extended in place when it
+	// ends the slab, otherwise it moves to the end and leaves its old
+	// space as garbage until 'compact' rebuilds the slab. Growing can
+	// move the whole slab, so a push invalidates pointers into any list
+	class WT {
+		Vec<WATCH, size_t>	_slab;
+		Vec<WSPAN>			_spans;
+		size_t				_junk;
+
+		inline void			grow		(WSPAN& s) {
+			const int cap = s.cap ? s.cap << 1 : WL_INIT_CAP;
+			const size_t end = _slab.size();
+			if (s.off + s.cap == end) _slab.reserve(s.off + cap, s.off + cap);
+			else {
+				_slab.reserve(end + cap, end + cap);
+				if (s.sz) std::memcpy(_slab + end, _slab + s.off, s.sz * sizeof(WATCH));
+				_junk += s.cap, s.off = end;
+			}
+			s.cap = cap;
+		}
+	public:
+		inline				WT			() : _junk(0) {}
+		inline WL			operator[]	(const uint32& lit) { return WL(*this, lit); }
+		inline uint32		size		() const { return _spans.size(); }
+		inline bool			empty		() const { return _spans.empty(); }
+		inline size_t		garbage		() const { return _junk; }
+		inline WATCH*		base		() const { return _slab.data(); }
+		inline WATCH*		data		(const uint32& lit) const { return _slab.data() + _spans[lit].off; }
+		inline WATCH*		end			(const uint32& lit) const { const WSPAN& s = _spans[lit]; return _slab.data() + s.off + s.sz; }
+		inline int			size		(const uint32& lit) const { return _spans[lit].sz; }
+		inline void			push		(const uint32& lit, const WATCH& w) {
+			WSPAN& s = _spans[lit];
+			if (s.sz == s.cap) grow(s);
+			_slab[s.off + s.sz++] = w;
+		}
+		inline void			resize		(const uint32& lit, const int& n) { assert(n <= _spans[lit].cap); _spans[lit].sz = n; }
+		inline void			clear		(const uint32& lit, const bool& _free) {
+			WSPAN& s = _spans[lit];
+			s.sz = 0;
+			if (_free) _junk += s.cap, s.cap = 0;
+		}
+		// hand the list of 'src' over to 'dest', dropping the one of 'dest'
+		inline void			move		(const uint32& dest, const uint32& src) {
+			assert(dest != src);
+			_junk += _spans[dest].cap;
+			_spans[dest] = _spans[src];
+			_spans[src] = { 0, 0, 0 };
+		}
+		inline void			resize		(const uint32& n) {
+			if (n < _spans.size()) {
+				for (uint32 lit = n; lit < _spans.size(); lit++) _junk += _spans[lit].cap;
+				_spans.resize(n);
+			}
+			else _spans.expand(n);
+		}
+		inline void			shrinkCap	() { _spans.shrinkCap(); }
+		inline void			clear		(const bool& _free = false) {
+			_spans.clear(_free), _slab.clear(_free), _junk = 0;
+		}
+		inline void			tag			(const Byte& cat) { _spans.tag(cat), _slab.tag(cat); }
+		// rebuild the slab with the lists laid out in literal order;
+		// 'update(lit, w)' returns false for a watch to be dropped.
+		// Binary watches are placed before the others in each list
+		template <class UPDATE>
+		inline void			compact		(UPDATE update) {
+			// each list gets at most its current size plus some room
+			size_t total = 0;
+			for (const WSPAN* s = _spans; s != _spans.end(); s++)
+				if (s->sz) total += s->sz + (s->sz >> 2) + 1;
+			Vec<WATCH, size_t> slab;
+			slab.tag(_slab.category());
+			slab.reserve(total);
+			for (uint32 lit = 0; lit < _spans.size(); lit++) {
+				WSPAN& s = _spans[lit];
+				WATCH* i = _slab + s.off, * end = i + s.sz, * k = i;
+				const size_t off = slab.size();
+				slab.reserve(off + s.sz, off + s.sz);
+				WATCH* j = slab + off;
+				for (; i != end; i++) {
+					WATCH w = *i;
+					if (!update(lit, w)) continue;
+					if (w.binary()) *j++ = w;
+					else *k++ = w;
+				}
+				for (i = _slab + s.off; i != k; i++) *j++ = *i;
+				const int sz = int(j - (slab + off));
+				// leave some room so the next push does not move the list
+				const int cap = sz ? sz + (sz >> 2) + 1 : 0;
+				slab.reserve(off + cap, off + cap);
+				s.off = off, s.sz = sz, s.cap = cap;
+			}
+			assert(slab.capacity() == total);
+			_slab.swap(slab);
+			slab.clear(true);
+			_junk = 0;
+		}
+	};
+
+	inline			WL::operator WATCH*	() const { return _wt.data(_lit); }
+	inline WATCH*	WL::end				() const { return _wt.end(_lit); }
+	inline WATCH&	WL::operator[]		(const int& i) const { assert(i < size()); return _wt.data(_lit)[i]; }
+	inline int		WL::size			() const { return _wt.size(_lit); }
+	inline void		WL::push			(const WATCH& w) const { _wt.push(_lit, w); }
+	inline void		WL::resize			(const int& n) const { _wt.resize(_lit, n); }
+	inline void		WL::clear			(const bool& _free) const { _wt.clear(_lit, _free); }
 }
 
 #endif
\ No newline at end of file
@@ -18,13 +18,20 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include "pfmemory.h"
+#include "pftrace.h"
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <functional>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 namespace pFROST {
+
+#define COMPACT_THR 16384
+
 	typedef std::function<void()> Job;
 
 	class WorkerPool {
@@ -37,6 +44,7 @@ namespace pFROST {
 		bool								_terminate;
 		unsigned int						_waiting;
 		unsigned int						_maxBatch;
+		inline static thread_local int		_id = -1;
 
 	public:
 		inline void init(unsigned int threads, unsigned int maxBatch)
@@ -49,7 +57,8 @@ namespace pFROST {
 			if (threads == 0) threads = 1;
 
 			for (unsigned int i = 0; i < threads; i++) {
-				_workers.push_back(std::thread([this] {
+				_workers.push_back(std::thread([this, i] {
+					_id = i;
 					while (true) {
 						std::unique_lock<std::mutex> lock(_mutex);
 						std::function<bool()> condition = [this] {
@@ -67,7 +76,10 @@ namespace pFROST {
 						_jobQueue.pop_back();
 						lock.unlock();
 
+						PFTRACE("job");
 						job();
+						// joined jobs leave no unpublished memory behind
+						memAccount.flush();
 					}
 				}));
 			}
@@ -112,7 +124,8 @@ namespace pFROST {
 			}
 
 			while (idx < end) {
-				IntType thisBatchSize = idx < remainder ? batchSize + 1 : batchSize;
+				IntType thisBatchSize = (idx - begin) < remainder ? batchSize + 1 : batchSize;
+				if (thisBatchSize < 1) thisBatchSize = 1;
 				if (idx + thisBatchSize > end) thisBatchSize = end - idx;
 				_jobQueue.push_back([this, idx, thisBatchSize, job] {
 					for (IntType j = idx; j < idx + thisBatchSize; j++)
@@ -130,21 +143,85 @@ namespace pFROST {
 			doWorkForEach(begin, end, (IntType)_maxBatch, job);
 		}
 
+		// guided scheduling: indices are claimed in order, every claim takes
+		// at least one index and as many more as fit in a share of the
+		// remaining cost; 'acc[i - begin]' is the cost of [begin, i), so an
+		// expensive index is claimed alone and cheap ones are batched
+		template<class IntType, class Function>
+		inline void doWorkGuided(const IntType& begin, const IntType& end, const uint64* acc, const Function& job)
+		{
+			std::unique_lock lock(_mutex);
+			auto next = std::make_shared<std::atomic<IntType>>(begin);
+			const uint64 share = uint64(_workers.size()) << 1;
+			for (unsigned int i = 0; i < _workers.size(); i++) {
+				_jobQueue.push_back([next, begin, end, acc, share, job] {
+					IntType idx = next->load(), chunk;
+					while (true) {
+						if (idx >= end) return;
+						const uint64* first = acc + (idx - begin);
+						const uint64 limit = *first + (acc[end - begin] - *first) / share;
+						chunk = IntType(std::upper_bound(first + 1, acc + (end - begin) + 1, limit) - first) - 1;
+						if (chunk < 1) chunk = 1;
+						if (!next->compare_exchange_weak(idx, idx + chunk)) continue;
+						for (IntType j = idx; j < idx + chunk; j++)
+							job(j);
+						idx = next->load();
+					}
+				});
+			}
+			_workerCV.notify_all();
+		}
+
+		// order-preserving removal of the elements of 'v' rejected by 'keep':
+		// every block squeezes its survivors in place and counts them, a prefix
+		// sum gives the block offsets and the blocks are scattered through a
+		// buffer; small inputs and calls from a worker are done sequentially
+		template<class Container, class Predicate>
+		inline void compact(Container& v, const Predicate& keep)
+		{
+			typedef typename std::decay<decltype(v[0])>::type T;
+			const size_t n = v.size(), blocks = _workers.size();
+			if (n < COMPACT_THR || blocks <= 1 || _id >= 0) {
+				size_t j = 0;
+				for (size_t i = 0; i < n; i++)
+					if (keep(v[i])) v[j++] = v[i];
+				v.resize(j);
+				return;
+			}
+			const size_t bsize = (n + blocks - 1) / blocks;
+			std::vector<size_t> offsets(blocks + 1, 0);
+			doWorkForEach((size_t)0, blocks, (size_t)1, [&](size_t b) {
+				const size_t first = std::min(b * bsize, n), last = std::min(first + bsize, n);
+				size_t j = first;
+				for (size_t i = first; i < last; i++)
+					if (keep(v[i])) v[j++] = v[i];
+				offsets[b + 1] = j - first;
+			});
+			join();
+			for (size_t b = 0; b < blocks; b++) offsets[b + 1] += offsets[b];
+			std::vector<T> buffer(offsets[blocks]);
+			doWorkForEach((size_t)0, blocks, (size_t)1, [&](size_t b) {
+				const size_t first = std::min(b * bsize, n);
+				for (size_t i = offsets[b]; i < offsets[b + 1]; i++)
+					buffer[i] = v[first + i - offsets[b]];
+			});
+			join();
+			doWorkForEach((size_t)0, blocks, (size_t)1, [&](size_t b) {
+				for (size_t i = offsets[b]; i < offsets[b + 1]; i++)
+					v[i] = buffer[i];
+			});
+			join();
+			v.resize(offsets[blocks]);
+		}
+
 		inline void join() const {
+			PFTRACE("join");
 			std::unique_lock<std::mutex> lock(_mutex);
 			_poolCV.wait(lock, [this] {
 				return _jobQueue.empty() && _waiting == _workers.size();
 			});
 		}
 
-		inline int getID() const {
-			std::thread::id realId = std::this_thread::get_id();
-
-			for (int i = 0; i < _workers.size(); i++) {
-				if (realId == _workers[i].get_id()) return i;
-			}
-
-			return -1;
-		}
+		inline int getID() const { return _id; }
 	};
 }
@@ -79,8 +79,9 @@ namespace pFROST {
 
                 for (uint32 i = begin; i < end; i++) {
                     uint32 deg = 0;
-                    for (uint32 j = 0; j < (*_ig)[i].children().size(); j++) {
-                        if (!(*_ig)[i].children()[j].second->deleted()) deg++;
+                    const EdgeRange cs = _ig->children(i);
+                    for (uint32 j = 0; j < cs.size(); j++) {
+                        if (!cs[j].second->deleted()) deg++;
                     }
                     out_degree[i] = deg;
                     n += deg;
@@ -111,9 +112,10 @@ namespace pFROST {
                 const uint32& lit1 = (uint32)i;
                 edge_t next_edge = begin[i];
 
-                for (uint32 j = 0; j < (*_ig)[lit1].children().size(); j++) {
-                    if (!(*_ig)[lit1].children()[j].second->deleted()) {
-                        const uint32& lit2 = (*_ig)[lit1].children()[j].first;
+                const EdgeRange cs = _ig->children(lit1);
+                for (uint32 j = 0; j < cs.size(); j++) {
+                    if (!cs[j].second->deleted()) {
+                        const uint32& lit2 = cs[j].first;
 
                         node_idx[next_edge] = (node_id)lit2;
                         e_idx2id[next_edge] = next_edge;